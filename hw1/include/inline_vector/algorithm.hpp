@@ -0,0 +1,307 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "inline_vector/inline_vector.hpp"
+
+// Largest inline capacity that is sorted by a sorting network
+constexpr std::size_t kSortNetworkLimit = 32;
+
+namespace inline_vector_detail {
+
+// Branchless compare-exchange
+template<class T>
+inline void compare_exchange(T& a, T& b) {
+    T x = a;
+    T y = b;
+    bool swap = y < x;
+    a = swap ? y : x;
+    b = swap ? x : y;
+}
+
+// Comparator of a sorting network, the smaller value goes to `lo`
+struct Comparator {
+    std::size_t lo;
+    std::size_t hi;
+};
+
+// Batcher's odd-even merge sort over exactly P elements, calls emit(lo, hi) per comparator
+template<class Emit>
+constexpr void odd_even_merge_network(std::size_t size, Emit emit) {
+    for (std::size_t p = 1; p < size; p *= 2) {
+        for (std::size_t k = p; k >= 1; k /= 2) {
+            for (std::size_t j = k % p; j + k < size; j += 2 * k) {
+                for (std::size_t i = 0; i < std::min(k, size - j - k); ++i) {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                        emit(i + j, i + j + k);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template<std::size_t P>
+struct SortingNetwork {
+    static constexpr std::size_t count() {
+        std::size_t result = 0;
+        odd_even_merge_network(P, [&result](std::size_t, std::size_t) { ++result; });
+        return result;
+    }
+
+    static constexpr std::size_t kSize = count();
+
+    static constexpr std::array<Comparator, kSize> make() {
+        std::array<Comparator, kSize> comparators{};
+        std::size_t index = 0;
+        odd_even_merge_network(P, [&comparators, &index](std::size_t lo, std::size_t hi) {
+            comparators[index++] = Comparator{lo, hi};
+        });
+        return comparators;
+    }
+
+    static constexpr std::array<Comparator, kSize> kComparators = make();
+};
+
+// Straight-line expansion of the network, one compare-exchange per comparator
+template<class T, std::size_t P, std::size_t... I>
+inline void network_sort(T* data, std::index_sequence<I...>) {
+    (compare_exchange(data[SortingNetwork<P>::kComparators[I].lo],
+                      data[SortingNetwork<P>::kComparators[I].hi]), ...);
+}
+
+// Filler for the unused tail of a network, sorts after every real value
+template<class T>
+constexpr T network_padding() {
+    return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                : std::numeric_limits<T>::max();
+}
+
+// Network width used for up to `size` elements: the next power of two, at least 4
+constexpr std::size_t network_width(std::size_t size) {
+    std::size_t width = 4;
+    while (width < size) {
+        width *= 2;
+    }
+    return width;
+}
+
+// Sorts `size <= P` elements with the P-wide network on a padded local copy,
+// so the values can stay in registers
+template<class T, std::size_t P>
+void padded_network_sort(T* data, std::size_t size) {
+    std::array<T, P> values;
+    std::copy(data, data + size, values.begin());
+    std::fill(values.begin() + size, values.end(), network_padding<T>());
+    network_sort<T, P>(values.data(), std::make_index_sequence<SortingNetwork<P>::kSize>());
+    std::copy(values.begin(), values.begin() + size, data);
+}
+
+// Only the power-of-two widths up to network_width(N) are instantiated, at most four
+// networks for N = 32, so the code size stays bounded instead of growing with every size
+template<class T, std::size_t N>
+inline void small_sort(T* data, std::size_t size) {
+    constexpr std::size_t kWidth = network_width(N);
+    if constexpr (kWidth > 4) {
+        if (size <= kWidth / 2) {
+            small_sort<T, kWidth / 2>(data, size);
+            return;
+        }
+    }
+    padded_network_sort<T, kWidth>(data, size);
+}
+
+// Keep the first of each run of equal values, returns the new end
+template<class T>
+inline T* branchless_unique(T* first, T* last) {
+    if (first == last) {
+        return last;
+    }
+    // The last kept value always equals the previous input, which avoids reloading it
+    T* out = first + 1;
+    T previous = *first;
+    for (T* it = first + 1; it < last; ++it) {
+        T value = *it;
+        *out = value;
+        out += (value != previous);
+        previous = value;
+    }
+    return out;
+}
+
+// Merge of two sorted ranges without branches on the data. Kept scalar: a vector merge with
+// duplicate removal needs SSE4.1 min/max and SSSE3 shuffles, the build targets baseline SSE2
+template<class T>
+inline T* merge_union(const T* a, const T* a_end, const T* b, const T* b_end, T* out) {
+    while (a < a_end && b < b_end) {
+        T x = *a;
+        T y = *b;
+        *out++ = std::min(x, y);
+        a += !(y < x);
+        b += !(x < y);
+    }
+    out = std::copy(a, a_end, out);
+    return std::copy(b, b_end, out);
+}
+
+template<class T>
+inline T* scalar_intersection(const T* a, const T* a_end, const T* b, const T* b_end, T* out) {
+    while (a < a_end && b < b_end) {
+        T x = *a;
+        T y = *b;
+        *out = x;
+        out += (x == y);
+        a += !(y < x);
+        b += !(x < y);
+    }
+    return out;
+}
+
+// 32-bit integers use an all-pairs SSE2 comparison of 4x4 blocks
+template<class T>
+constexpr bool kSimdIntersection =
+#if defined(__SSE2__)
+    std::is_integral<T>::value && sizeof(T) == 4;
+#else
+    false;
+#endif
+
+#if defined(__SSE2__)
+// Whether any of the 4 values at `block` equals the value before it, the first block has no predecessor
+template<class T>
+inline bool has_repeat(const T* block, const T* begin) {
+    __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+    if (block == begin) {
+        __m128i shifted = _mm_shuffle_epi32(values, _MM_SHUFFLE(2, 1, 0, 0));
+        return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(values, shifted))) & ~1;
+    }
+    __m128i previous = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block - 1));
+    return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(values, previous)));
+}
+
+// The all-pairs compare stores a value once per equal pair, which is only right for sets.
+// A repeated value restarts with the scalar kernel, so multisets get std::set_intersection
+// counts and the output never outgrows min(lhs, rhs).
+template<class T>
+inline T* simd_intersection(const T* a, const T* a_end, const T* b, const T* b_end, T* out) {
+    const T* a_begin = a;
+    const T* b_begin = b;
+    T* out_begin = out;
+    while (a_end - a >= 4 && b_end - b >= 4) {
+        if (has_repeat(a, a_begin) || has_repeat(b, b_begin)) {
+            return scalar_intersection(a_begin, a_end, b_begin, b_end, out_begin);
+        }
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+        __m128i match = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi32(va, vb),
+                         _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)))),
+            _mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))),
+                         _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)))));
+        for (int mask = _mm_movemask_ps(_mm_castsi128_ps(match)); mask; mask &= mask - 1) {
+            *out++ = a[__builtin_ctz(mask)];
+        }
+        T a_max = a[3];
+        T b_max = b[3];
+        a += (a_max <= b_max) * 4;
+        b += (b_max <= a_max) * 4;
+    }
+    // A run continuing into the tail may already have been matched by the blocks
+    if ((a != a_begin && a != a_end && a[-1] == a[0]) || (b != b_begin && b != b_end && b[-1] == b[0])) {
+        return scalar_intersection(a_begin, a_end, b_begin, b_end, out_begin);
+    }
+    return scalar_intersection(a, a_end, b, b_end, out);
+}
+#endif
+
+}  // namespace inline_vector_detail
+
+// Sort ascending. Inline arithmetic vectors with N <= kSortNetworkLimit use a sorting network,
+// everything else uses std::sort.
+template<class T, std::size_t N, class Allocator, class CopyPolicy, std::size_t Alignment>
+void sort(InlineVector<T, N, Allocator, CopyPolicy, Alignment>& vec) {
+    if (vec.size() < 2) {
+        return;
+    }
+    if constexpr (std::is_arithmetic<T>::value && N <= kSortNetworkLimit) {
+        if (vec.size() <= N) {
+            inline_vector_detail::small_sort<T, N>(vec.begin(), vec.size());
+            return;
+        }
+    }
+    std::sort(vec.begin(), vec.end());
+}
+
+// Remove consecutive duplicates, returns the new size
+template<class T, std::size_t N, class Allocator, class CopyPolicy, std::size_t Alignment>
+std::size_t unique(InlineVector<T, N, Allocator, CopyPolicy, Alignment>& vec) {
+    T* last;
+    if constexpr (std::is_arithmetic<T>::value) {
+        last = vec.size() <= N ? inline_vector_detail::branchless_unique(vec.begin(), vec.end())
+                               : std::unique(vec.begin(), vec.end());
+    } else {
+        last = std::unique(vec.begin(), vec.end());
+    }
+    vec.resize(last - vec.begin());
+    return vec.size();
+}
+
+// Union of two sorted vectors, repeated values appear max(count in lhs, count in rhs) times
+template<class T, std::size_t N, class Allocator, class CopyPolicy, std::size_t Alignment>
+InlineVector<T, N, Allocator, CopyPolicy, Alignment> set_union(
+    const InlineVector<T, N, Allocator, CopyPolicy, Alignment>& lhs,
+    const InlineVector<T, N, Allocator, CopyPolicy, Alignment>& rhs) {
+    InlineVector<T, N, Allocator, CopyPolicy, Alignment> result;
+    T* last;
+    if constexpr (std::is_arithmetic<T>::value) {
+        // Two inline inputs whose sum does not fit merge on the stack, so the result only spills
+        // if it really is larger than N
+        if (lhs.size() + rhs.size() > N && lhs.size() <= N && rhs.size() <= N) {
+            std::array<T, 2 * N> buffer;
+            last = inline_vector_detail::merge_union(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), buffer.data());
+            result.resize_for_overwrite(last - buffer.data());
+            std::copy(buffer.data(), last, result.begin());
+            return result;
+        }
+        result.resize_for_overwrite(lhs.size() + rhs.size());
+        last = inline_vector_detail::merge_union(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), result.begin());
+    } else {
+        result.resize(lhs.size() + rhs.size());
+        last = std::set_union(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), result.begin());
+    }
+    result.resize(last - result.begin());
+    return result;
+}
+
+// Intersection of two sorted vectors, repeated values appear min(count in lhs, count in rhs) times
+template<class T, std::size_t N, class Allocator, class CopyPolicy, std::size_t Alignment>
+InlineVector<T, N, Allocator, CopyPolicy, Alignment> set_intersection(
+    const InlineVector<T, N, Allocator, CopyPolicy, Alignment>& lhs,
+    const InlineVector<T, N, Allocator, CopyPolicy, Alignment>& rhs) {
+    InlineVector<T, N, Allocator, CopyPolicy, Alignment> result;
+    result.resize(std::min(lhs.size(), rhs.size()));
+    T* last;
+#if defined(__SSE2__)
+    if constexpr (inline_vector_detail::kSimdIntersection<T>) {
+        last = inline_vector_detail::simd_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                                        result.begin());
+    } else
+#endif
+    if constexpr (std::is_arithmetic<T>::value) {
+        last = inline_vector_detail::scalar_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                                          result.begin());
+    } else {
+        last = std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), result.begin());
+    }
+    result.resize(last - result.begin());
+    return result;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+// Allocator adaptor returning blocks aligned to `Alignment` bytes.
+// Memory comes from `Upstream` (rebound to bytes) with room to align the block and
+// to keep the original pointer right before it.
+template<class T, std::size_t Alignment, class Upstream = std::allocator<T>>
+class AlignedAllocator {
+
+    static_assert((Alignment & (Alignment - 1)) == 0, "alignment must be a power of two");
+    static_assert(Alignment >= alignof(T), "alignment must not be weaker than the natural one");
+
+    using ByteAllocator = typename std::allocator_traits<Upstream>::template rebind_alloc<unsigned char>;
+
+public:
+    using value_type = T;
+
+    template<class U>
+    struct rebind {
+        using other = AlignedAllocator<U, (Alignment > alignof(U) ? Alignment : alignof(U)),
+                                       typename std::allocator_traits<Upstream>::template rebind_alloc<U>>;
+    };
+
+    AlignedAllocator() = default;
+
+    template<class U, std::size_t A, class V>
+    AlignedAllocator(const AlignedAllocator<U, A, V>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        unsigned char* raw = upstream_.allocate(raw_size(n));
+        auto address = reinterpret_cast<std::uintptr_t>(raw + sizeof(raw));
+        auto* aligned = reinterpret_cast<unsigned char*>((address + Alignment - 1) & ~(Alignment - 1));
+        std::memcpy(aligned - sizeof(raw), &raw, sizeof(raw));
+        return reinterpret_cast<T*>(aligned);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        unsigned char* raw;
+        std::memcpy(&raw, reinterpret_cast<unsigned char*>(p) - sizeof(raw), sizeof(raw));
+        upstream_.deallocate(raw, raw_size(n));
+    }
+
+    template<class U>
+    void destroy(U* p) {
+        p->~U();
+    }
+
+    friend bool operator==(const AlignedAllocator&, const AlignedAllocator&) noexcept { return true; }
+    friend bool operator!=(const AlignedAllocator&, const AlignedAllocator&) noexcept { return false; }
+
+private:
+    static std::size_t raw_size(std::size_t n) noexcept {
+        return n * sizeof(T) + sizeof(unsigned char*) + Alignment - 1;
+    }
+
+    ByteAllocator upstream_;
+};
+
+namespace inline_vector_detail {
+
+// Allocator for heap blocks of an InlineVector with the given alignment
+template<class T, class Allocator, std::size_t Alignment>
+using aligned_allocator_t = std::conditional_t<(Alignment > alignof(T)),
+                                               AlignedAllocator<T, Alignment, Allocator>, Allocator>;
+
+// Alignment of the blocks an allocator returns: the AlignedAllocator parameter, otherwise natural
+template<class Allocator>
+struct AllocatorAlignment : std::integral_constant<std::size_t, alignof(typename Allocator::value_type)> {};
+
+template<class T, std::size_t Alignment, class Upstream>
+struct AllocatorAlignment<AlignedAllocator<T, Alignment, Upstream>> : std::integral_constant<std::size_t, Alignment> {};
+
+}  // namespace inline_vector_detail
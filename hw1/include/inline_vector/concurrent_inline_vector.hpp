@@ -0,0 +1,176 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include "inline_vector/inline_vector.hpp"
+#include "inline_vector/segments.hpp"
+
+// Append-only vector for many producer threads.
+// The first N elements live in the object, the rest in segments that are never
+// relocated, so references returned by push_back stay valid until destruction.
+template<class T, std::size_t N, class Allocator = std::allocator<T>>
+class ConcurrentInlineVector {
+
+public:
+    // Aliases for types
+    using size_type = std::size_t;
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+
+    // Simple constructor
+    ConcurrentInlineVector() noexcept : size_(0) {
+        for (auto& segment : segments_) {
+            segment.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ConcurrentInlineVector(const ConcurrentInlineVector&) = delete;
+    ConcurrentInlineVector& operator=(const ConcurrentInlineVector&) = delete;
+
+    // Destructor
+    ~ConcurrentInlineVector() {
+        clear();
+    }
+
+    // Adding element to the end, safe to call from any number of threads.
+    // Reserving the slot is a single fetch_add and each segment is allocated by one thread.
+    // The producer taking the first slot of segment k also allocates segment k + 1, so the
+    // others only wait if they fill a whole segment before that allocation finishes, or on
+    // the first spill out of the inline array. push_back is therefore not wait-free.
+    reference push_back(const_reference value) {
+        size_type index = size_.fetch_add(1, std::memory_order_relaxed);
+        if (index < N) {
+            inline_data_[index] = value;
+            return inline_data_[index];
+        }
+        auto position = inline_vector_detail::segment_position(index - N, kSegmentBase);
+        reference slot = segment_data(position.segment)[position.offset];
+        slot = value;
+        if (position.offset == 0 && position.segment + 1 < segments_.size()) {
+            try {
+                start_segment(position.segment + 1);
+            } catch (...) {
+                // The element is stored, the producer that needs the segment retries and throws
+            }
+        }
+        return slot;
+    }
+
+    // Number of reserved slots, includes pushes that may still be in flight
+    size_type size() const noexcept {
+        return size_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    // Index access to elements whose push_back has completed
+    reference operator[](size_type index) {
+        return const_cast<reference>(static_cast<const ConcurrentInlineVector&>(*this)[index]);
+    }
+
+    const_reference operator[](size_type index) const {
+        if (index >= size()) {
+            throw std::out_of_range("`ConcurrentInlineVector::operator[]` index out of range");
+        }
+        if (index < N) {
+            return inline_data_[index];
+        }
+        auto position = inline_vector_detail::segment_position(index - N, kSegmentBase);
+        return segments_[position.segment].load(std::memory_order_acquire)[position.offset];
+    }
+
+    // Copy into a plain InlineVector, producers must have finished
+    InlineVector<T, N, Allocator> freeze() const {
+        InlineVector<T, N, Allocator> result;
+        for (size_type i = 0; i < size(); ++i) {
+            result.push_back((*this)[i]);
+        }
+        return result;
+    }
+
+    // Remove all elements and release segments, producers must have finished
+    void clear() noexcept {
+        for (size_type segment = 0; segment < segments_.size(); ++segment) {
+            pointer data = segments_[segment].exchange(nullptr, std::memory_order_acq_rel);
+            if (data) {
+                free_segment(data, segment);
+            }
+        }
+        size_.store(0, std::memory_order_release);
+    }
+
+private:
+    static constexpr size_type kSegmentBase = N > 0 ? N : 1;
+
+    // Marks a segment whose allocation is in progress, never dereferenced
+    static pointer allocating() noexcept {
+        return reinterpret_cast<pointer>(alignof(T));
+    }
+
+    // Address of a segment, allocating it or waiting for the thread that does
+    pointer segment_data(size_type index) {
+        pointer data = segments_[index].load(std::memory_order_acquire);
+        while (!data || data == allocating()) {
+            if (data) {
+                std::this_thread::yield();
+            } else {
+                start_segment(index);
+            }
+            data = segments_[index].load(std::memory_order_acquire);
+        }
+        return data;
+    }
+
+    // Allocate a segment unless another thread already has or is doing it. Only the thread
+    // that swaps null for the marker allocates, so memory use does not grow with the number
+    // of producers; a failed allocation resets the marker for the next thread to retry.
+    void start_segment(size_type index) {
+        std::atomic<pointer>& segment = segments_[index];
+        pointer expected = nullptr;
+        if (!segment.compare_exchange_strong(expected, allocating(), std::memory_order_acq_rel,
+                                             std::memory_order_acquire)) {
+            return;
+        }
+        pointer data;
+        try {
+            data = allocate_segment(index);
+        } catch (...) {
+            segment.store(nullptr, std::memory_order_release);
+            throw;
+        }
+        segment.store(data, std::memory_order_release);
+    }
+
+    // Slots are default-initialised, push_back assigns over them, so trivial types are not zeroed
+    pointer allocate_segment(size_type segment) {
+        size_type count = inline_vector_detail::segment_size(segment, kSegmentBase);
+        pointer data = allocator_.allocate(count);
+        try {
+            std::uninitialized_default_construct_n(data, count);
+        } catch (...) {
+            allocator_.deallocate(data, count);
+            throw;
+        }
+        return data;
+    }
+
+    void free_segment(pointer data, size_type segment) noexcept {
+        size_type count = inline_vector_detail::segment_size(segment, kSegmentBase);
+        std::destroy_n(data, count);
+        allocator_.deallocate(data, count);
+    }
+
+    std::atomic<size_type> size_;
+    std::array<std::atomic<pointer>, inline_vector_detail::kMaxSegments> segments_;
+    Allocator allocator_;
+    std::array<value_type, N> inline_data_;
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include <sys/mman.h>
+
+// Size of a transparent huge page on x86-64 and most aarch64 kernels
+constexpr std::size_t kHugePageSize = std::size_t(2) << 20;
+
+// Allocator that backs blocks of at least `Threshold` bytes with anonymous mappings
+// advised for transparent huge pages, smaller blocks come from `Upstream`.
+// reallocate() grows mapped blocks with mremap, so InlineVector of a trivially copyable
+// type grows without copying. If huge pages are disabled the mappings use normal pages.
+template<class T, std::size_t Threshold = kHugePageSize, class Upstream = std::allocator<T>>
+class HugePageAllocator {
+
+public:
+    using value_type = T;
+
+    template<class U>
+    struct rebind {
+        using other = HugePageAllocator<U, Threshold, typename std::allocator_traits<Upstream>::template rebind_alloc<U>>;
+    };
+
+    HugePageAllocator() = default;
+
+    template<class U, std::size_t S, class V>
+    HugePageAllocator(const HugePageAllocator<U, S, V>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        if (n * sizeof(T) < Threshold) {
+            return upstream_.allocate(n);
+        }
+        return static_cast<T*>(map(mapped_size(n)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        if (n * sizeof(T) < Threshold) {
+            upstream_.deallocate(p, n);
+        } else {
+            ::munmap(p, mapped_size(n));
+        }
+    }
+
+    // Resize a block keeping its first min(old_n, new_n) elements, which are moved bitwise
+    T* reallocate(T* p, std::size_t old_n, std::size_t new_n) {
+#if defined(__linux__)
+        if (old_n * sizeof(T) >= Threshold && new_n * sizeof(T) >= Threshold) {
+            void* data = ::mremap(p, mapped_size(old_n), mapped_size(new_n), MREMAP_MAYMOVE);
+            if (data == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            advise(data, mapped_size(new_n));
+            return static_cast<T*>(data);
+        }
+#endif
+        T* data = allocate(new_n);
+        std::memcpy(static_cast<void*>(data), p, std::min(old_n, new_n) * sizeof(T));
+        deallocate(p, old_n);
+        return data;
+    }
+
+    template<class U>
+    void destroy(U* p) {
+        p->~U();
+    }
+
+    friend bool operator==(const HugePageAllocator&, const HugePageAllocator&) noexcept { return true; }
+    friend bool operator!=(const HugePageAllocator&, const HugePageAllocator&) noexcept { return false; }
+
+private:
+    // Mappings are whole huge pages, so no page of the block is left small
+    static std::size_t mapped_size(std::size_t n) noexcept {
+        return (n * sizeof(T) + kHugePageSize - 1) & ~(kHugePageSize - 1);
+    }
+
+    static void advise(void* data, std::size_t size) noexcept {
+#if defined(MADV_HUGEPAGE)
+        // Failure only means huge pages are unavailable, the mapping itself is fine
+        ::madvise(data, size, MADV_HUGEPAGE);
+#else
+        (void)data;
+        (void)size;
+#endif
+    }
+
+    // Map `size` bytes aligned to a huge page, trimming the extra head and tail
+    static void* map(std::size_t size) {
+        void* raw = ::mmap(nullptr, size + kHugePageSize, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        auto address = reinterpret_cast<std::uintptr_t>(raw);
+        auto aligned = (address + kHugePageSize - 1) & ~(kHugePageSize - 1);
+        if (aligned > address) {
+            ::munmap(raw, aligned - address);
+        }
+        if (std::size_t tail = address + kHugePageSize - aligned) {
+            ::munmap(reinterpret_cast<void*>(aligned + size), tail);
+        }
+        void* data = reinterpret_cast<void*>(aligned);
+        advise(data, size);
+        return data;
+    }
+
+    Upstream upstream_;
+};
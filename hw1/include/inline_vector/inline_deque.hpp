@@ -0,0 +1,292 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "inline_vector/inline_vector.hpp"
+
+// Double-ended queue with inline capacity.
+// Elements live in a ring over the inline block, and once it is full the ring is
+// linearised into a power-of-two heap block, so push and pop at both ends are O(1).
+template<class T, std::size_t N, class Allocator = std::allocator<T>>
+class InlineDeque : private InlineStorage<T, N> {
+
+    using Storage = InlineStorage<T, N>;
+
+    // Random access iterator over logical positions
+    template<class Value>
+    class Iterator {
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        Iterator() noexcept : owner_(nullptr), index_(0) {}
+        Iterator(const InlineDeque* owner, std::size_t index) noexcept : owner_(owner), index_(index) {}
+
+        // iterator converts to const_iterator
+        template<class Other, class = std::enable_if_t<std::is_const<Value>::value && !std::is_const<Other>::value>>
+        Iterator(const Iterator<Other>& other) noexcept : Iterator(other.owner_, other.index_) {}
+
+        reference operator*() const { return *owner_->slot(index_); }
+        pointer operator->() const { return owner_->slot(index_); }
+        reference operator[](difference_type offset) const { return *owner_->slot(index_ + offset); }
+
+        Iterator& operator++() { ++index_; return *this; }
+        Iterator operator++(int) { Iterator copy = *this; ++index_; return copy; }
+        Iterator& operator--() { --index_; return *this; }
+        Iterator operator--(int) { Iterator copy = *this; --index_; return copy; }
+        Iterator& operator+=(difference_type offset) { index_ += offset; return *this; }
+        Iterator& operator-=(difference_type offset) { index_ -= offset; return *this; }
+        Iterator operator+(difference_type offset) const { return Iterator(owner_, index_ + offset); }
+        Iterator operator-(difference_type offset) const { return Iterator(owner_, index_ - offset); }
+        friend Iterator operator+(difference_type offset, const Iterator& it) { return it + offset; }
+
+        difference_type operator-(const Iterator& other) const {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+        }
+
+        bool operator==(const Iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const Iterator& other) const { return index_ != other.index_; }
+        bool operator<(const Iterator& other) const { return index_ < other.index_; }
+        bool operator>(const Iterator& other) const { return index_ > other.index_; }
+        bool operator<=(const Iterator& other) const { return index_ <= other.index_; }
+        bool operator>=(const Iterator& other) const { return index_ >= other.index_; }
+
+    private:
+        template<class> friend class Iterator;
+
+        const InlineDeque* owner_;
+        std::size_t index_;
+    };
+
+public:
+    // Aliases for types
+    using size_type = std::size_t;
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+
+    // Simple constructor
+    InlineDeque() noexcept : head_(0), size_(0), capacity_(N), data_(Storage::sized_data.data()) {}
+
+    // Initializer list constructor
+    InlineDeque(std::initializer_list<value_type> list) : InlineDeque() {
+        for (auto i : list) {
+            push_back(i);
+        }
+    }
+
+    // Copy constructor
+    InlineDeque(const InlineDeque& other) : InlineDeque() {
+        for (const auto& value : other) {
+            push_back(value);
+        }
+    }
+
+    // Assignment operator
+    InlineDeque& operator=(const InlineDeque& other) {
+        if (this != &other) {
+            clear();
+            for (const auto& value : other) {
+                push_back(value);
+            }
+        }
+        return *this;
+    }
+
+    // Destructor
+    ~InlineDeque() {
+        clear();
+    }
+
+    // Deque size
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    // Inline capacity, or the heap ring size after a spill
+    size_type capacity() const noexcept {
+        return capacity_;
+    }
+
+    // Check for emptiness
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Index access to the element
+    reference operator[](size_type index) {
+        return const_cast<reference>(static_cast<const InlineDeque&>(*this)[index]);
+    }
+
+    const_reference operator[](size_type index) const {
+        if (index >= size_) {
+            throw std::out_of_range("`InlineDeque::operator[]` index out of range");
+        }
+        return *slot(index);
+    }
+
+    // First element access
+    reference front() {
+        return const_cast<reference>(static_cast<const InlineDeque&>(*this).front());
+    }
+
+    const_reference front() const {
+        if (size_ == 0) {
+            throw std::out_of_range("`InlineDeque::front()` deque is empty");
+        }
+        return *slot(0);
+    }
+
+    // Last element access
+    reference back() {
+        return const_cast<reference>(static_cast<const InlineDeque&>(*this).back());
+    }
+
+    const_reference back() const {
+        if (size_ == 0) {
+            throw std::out_of_range("`InlineDeque::back()` deque is empty");
+        }
+        return *slot(size_ - 1);
+    }
+
+    // Adding element to the end
+    void push_back(const_reference value) {
+        if (size_ == capacity_) {
+            grow();
+        }
+        *slot(size_) = value;
+        ++size_;
+    }
+
+    // Adding element to the start
+    void push_front(const_reference value) {
+        if (size_ == capacity_) {
+            grow();
+        }
+        head_ = head_ == 0 ? capacity_ - 1 : head_ - 1;
+        ++size_;
+        *slot(0) = value;
+    }
+
+    // Deleting last element
+    void pop_back() {
+        if (size_ == 0) {
+            throw std::out_of_range("`InlineDeque::pop_back()` deque is empty");
+        }
+        --size_;
+    }
+
+    // Deleting first element
+    void pop_front() {
+        if (size_ == 0) {
+            throw std::out_of_range("`InlineDeque::pop_front()` deque is empty");
+        }
+        head_ = wrap(head_ + 1);
+        --size_;
+    }
+
+    // Iterators over all elements
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size_); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+    // Clear deque from elements and release the heap ring
+    void clear() noexcept {
+        if (spilled()) {
+            std::destroy_n(data_, capacity_);
+            allocator_.deallocate(data_, capacity_);
+            data_ = Storage::sized_data.data();
+        }
+        capacity_ = N;
+        head_ = 0;
+        size_ = 0;
+    }
+
+    // Move back to the inline block if the elements fit there.
+    // Popping never does this by itself, so a queue hovering around N does not spill repeatedly.
+    void shrink_to_fit() {
+        if (!spilled() || size_ > N) {
+            return;
+        }
+        for (size_type i = 0; i < size_; ++i) {
+            Storage::sized_data[i] = std::move(*slot(i));
+        }
+        size_type size = size_;
+        clear();
+        size_ = size;
+    }
+
+    // Equality check operator
+    friend bool operator==(const InlineDeque& lhs, const InlineDeque& rhs) {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend bool operator!=(const InlineDeque& lhs, const InlineDeque& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    bool spilled() const noexcept {
+        return data_ != Storage::sized_data.data();
+    }
+
+    // Ring position to storage index. Positions never reach twice the capacity,
+    // so one conditional subtraction works for the inline ring of any N as well.
+    size_type wrap(size_type position) const noexcept {
+        return position >= capacity_ ? position - capacity_ : position;
+    }
+
+    pointer slot(size_type index) const noexcept {
+        return data_ + wrap(head_ + index);
+    }
+
+    // Copy the ring in logical order into a heap block twice as large
+    void grow() {
+        size_type new_capacity = 1;
+        while (new_capacity <= capacity_) {
+            new_capacity *= 2;
+        }
+        pointer new_data = allocator_.allocate(new_capacity);
+        try {
+            std::uninitialized_value_construct_n(new_data, new_capacity);
+        } catch (...) {
+            allocator_.deallocate(new_data, new_capacity);
+            throw;
+        }
+        try {
+            for (size_type i = 0; i < size_; ++i) {
+                new_data[i] = std::move(*slot(i));
+            }
+        } catch (...) {
+            std::destroy_n(new_data, new_capacity);
+            allocator_.deallocate(new_data, new_capacity);
+            throw;
+        }
+        size_type size = size_;
+        clear();
+        data_ = new_data;
+        capacity_ = new_capacity;
+        size_ = size;
+    }
+
+    size_type head_;
+    size_type size_;
+    size_type capacity_;
+    pointer data_;
+    Allocator allocator_;
+};
@@ -1,9 +1,63 @@
+#pragma once
+
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <stdexcept>
 #include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+#include "inline_vector/aligned_allocator.hpp"
+
+// Copy policies: DeepCopy copies the heap block on every copy,
+// CopyOnWrite shares it between copies until one of them is modified
+struct DeepCopy {};
+struct CopyOnWrite {};
+
+namespace inline_vector_detail {
+
+// Allocators may provide reallocate(p, old_n, new_n) that moves a block bitwise
+template<class Allocator, class T, class = void>
+struct HasReallocate : std::false_type {};
+
+template<class Allocator, class T>
+struct HasReallocate<Allocator, T, std::void_t<decltype(std::declval<Allocator&>().reallocate(
+    std::declval<T*>(), std::size_t(), std::size_t()))>> : std::true_type {};
+
+template<class Allocator, class T>
+constexpr bool kCanReallocate = HasReallocate<Allocator, T>::value && std::is_trivially_copyable<T>::value;
+
+// Reference count pointer of a shared heap block. Only CopyOnWrite shares blocks,
+// the empty specialization keeps DeepCopy vectors from paying for it.
+template<class RefCount, bool kShared>
+class RefCountHolder {
 
-template<class T, std::size_t N, class Allocator = std::allocator<T>>
-class InlineVector {
+protected:
+    RefCount* refs() const noexcept { return refs_; }
+    void set_refs(RefCount* refs) noexcept { refs_ = refs; }
+
+private:
+    RefCount* refs_ = nullptr;
+};
+
+template<class RefCount>
+class RefCountHolder<RefCount, false> {
+
+protected:
+    RefCount* refs() const noexcept { return nullptr; }
+    void set_refs(RefCount*) noexcept {}
+};
+
+}  // namespace inline_vector_detail
+
+// N-independent part of InlineVector: growth, insert and erase logic.
+// The derived InlineVector only supplies the inline buffer, so functions that take
+// an InlineVectorBase& accept vectors of any inline capacity without being templates.
+template<class T, class Allocator = std::allocator<T>, class CopyPolicy = DeepCopy>
+class InlineVectorBase {
 
 public:
     // Aliases for types
@@ -17,8 +71,14 @@ public:
     using const_iterator = const T*;
 
 private:
+    static constexpr bool kCopyOnWrite = std::is_same<CopyPolicy, CopyOnWrite>::value;
+
+    using RefCount = std::atomic<size_type>;
+
     // Class for handling dynamic data
-    class DynData {
+    class DynData : private inline_vector_detail::RefCountHolder<RefCount, kCopyOnWrite> {
+
+        using RefAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<RefCount>;
 
     public:
         // Constructor
@@ -29,18 +89,53 @@ private:
             clear();
         }
 
+        // Drop this owner's reference, the block is freed by its last owner
         void clear() noexcept {
             if (data_) {
-                for (size_type i = 0; i <= capacity_; i++) {
-                    allocator_.destroy(data_ + i);
+                RefCount* refs = this->refs();
+                if (!refs || refs->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    for (size_type i = 0; i < capacity_; i++) {
+                        allocator_.destroy(data_ + i);
+                    }
+                    allocator_.deallocate(data_, capacity_);
+                    free_refs(refs);
                 }
-                allocator_.deallocate(data_, capacity_);
                 data_ = nullptr;
+                this->set_refs(nullptr);
                 capacity_ = 0;
                 size_ = 0;
             }
         }
 
+        // Become another owner of `other`'s block (CopyOnWrite only)
+        void share(const DynData& other) noexcept {
+            if (data_ == other.data_) {
+                size_ = other.size_;
+                return;
+            }
+            clear();
+            data_ = other.data_;
+            this->set_refs(other.refs());
+            capacity_ = other.capacity_;
+            size_ = other.size_;
+            this->refs()->fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Whether other owners see this block (CopyOnWrite only)
+        bool shared() const noexcept {
+            RefCount* refs = this->refs();
+            return refs && refs->load(std::memory_order_acquire) != 1;
+        }
+
+        // Take a private copy of a shared block before writing to it
+        void detach() {
+            if (shared()) {
+                pointer new_dyn_data = allocator_.allocate(capacity_);
+                std::uninitialized_copy(data_, data_ + capacity_, new_dyn_data);
+                replace(new_dyn_data, capacity_);
+            }
+        }
+
         reference operator[](size_type index) {
             if (index >= size_) {
                 throw std::out_of_range("`InlineVector::DynData::operator[]` index out of range");
@@ -69,16 +164,51 @@ private:
                 while (new_dyn_capacity < new_capacity) {
                     new_dyn_capacity *= 2;
                 }
+                // Trivially copyable blocks are grown in place by the allocator when it can.
+                // Callers detach shared blocks before growing, so the block is not shared here.
+                if constexpr (inline_vector_detail::kCanReallocate<Allocator, T>) {
+                    if (data_) {
+                        data_ = allocator_.reallocate(data_, capacity_, new_dyn_capacity);
+                        std::uninitialized_default_construct(data_ + capacity_, data_ + new_dyn_capacity);
+                        capacity_ = new_dyn_capacity;
+                        size_ = new_capacity;
+                        return;
+                    }
+                }
+                // Every slot holds a live object, so non-trivial types can be assigned into.
+                // Slots past the size are default-initialized, which leaves trivial types untouched.
                 pointer new_dyn_data = allocator_.allocate(new_dyn_capacity);
-                std::uninitialized_copy(data_, data_ + capacity_, new_dyn_data);
-                allocator_.deallocate(data_, capacity_);
-                data_ = new_dyn_data;
-                capacity_ = new_dyn_capacity;
+                std::uninitialized_copy(data_, data_ + size_, new_dyn_data);
+                std::uninitialized_default_construct(new_dyn_data + size_, new_dyn_data + new_dyn_capacity);
+                replace(new_dyn_data, new_dyn_capacity);
             }
             size_ = new_capacity;
         }
 
     private:
+        // Switch to a freshly allocated block that this owner holds alone
+        void replace(pointer new_dyn_data, size_type new_dyn_capacity) {
+            RefCount* new_refs = nullptr;
+            if constexpr (kCopyOnWrite) {
+                RefAllocator ref_allocator;
+                new_refs = ref_allocator.allocate(1);
+                new (new_refs) RefCount(1);
+            }
+            size_type old_size = size_;
+            clear();
+            size_ = old_size;
+            data_ = new_dyn_data;
+            this->set_refs(new_refs);
+            capacity_ = new_dyn_capacity;
+        }
+
+        static void free_refs(RefCount* refs) noexcept {
+            if (refs) {
+                RefAllocator ref_allocator;
+                ref_allocator.deallocate(refs, 1);
+            }
+        }
+
         Allocator allocator_;
         pointer data_;
         size_type capacity_;
@@ -86,47 +216,41 @@ private:
     };
 
     void sized_to_dyn() {
-        std::copy(sized_data.begin(), sized_data.end(), dyn_data.begin());
-    }
-
-    void dyn_to_sized() {
-        std::copy(dyn_data.begin(), dyn_data.begin() + N, sized_data.begin());
+        std::copy(inline_data(), inline_data() + inline_capacity_, dyn_data.begin());
     }
 
-public:
-    // Simple constructor
-    InlineVector() noexcept: size_(0), dyn_data(DynData()) {}
-
-    // Initializer list constructor
-    InlineVector(std::initializer_list<value_type> list) : InlineVector() {
-        for (auto i : list) {
-            push_back(i);
+    // Called before anything that may write to the heap block
+    void detach() {
+        if constexpr (kCopyOnWrite) {
+            if (size_ > inline_capacity_)
+                dyn_data.detach();
         }
     }
 
-    // Copy constructor
-    InlineVector(const InlineVector& other) : size_(other.size_) {
-        if (other.size_ > N)
-            dyn_data.reserve(other.size_);
-        std::copy(other.begin(), other.end(), begin());
-    }
-
-    // Assignment operator
-    InlineVector& operator=(const InlineVector& other) {
-        if (this != &other) {
-            size_ = other.size_;
-            if (other.size_ > N) {
+    // Keep the first `count` elements, moving them back to the inline buffer if they fit.
+    // Never allocates, so shrinking costs at most inline_capacity_ element moves. A block
+    // still shared under CopyOnWrite (pop_back does not detach) is copied from instead.
+    void truncate(size_type count) {
+        if (size_ > inline_capacity_) {
+            if (count <= inline_capacity_) {
+                if (dyn_data.shared()) {
+                    std::copy(dyn_data.begin(), dyn_data.begin() + count, inline_data());
+                } else {
+                    std::move(dyn_data.begin(), dyn_data.begin() + count, inline_data());
+                }
                 dyn_data.clear();
-                dyn_data.reserve(other.size_);
+            } else {
+                dyn_data.reserve(count);
             }
-            std::copy(other.begin(), other.end(), begin());
         }
-        return *this;
+        size_ = count;
     }
 
-    // Destructor
-    ~InlineVector() {
-        clear();
+public:
+    // Assignment operator, works across different inline capacities
+    InlineVectorBase& operator=(const InlineVectorBase& other) {
+        copy_from(other);
+        return *this;
     }
 
     // Vector size
@@ -134,9 +258,14 @@ public:
         return size_;
     }
 
+    // Number of elements stored without heap allocation
+    size_type inline_capacity() const noexcept {
+        return inline_capacity_;
+    }
+
     // Vector max size
     size_type capacity() const noexcept {
-        return size_ <= N ? N : dyn_data.capacity();
+        return size_ <= inline_capacity_ ? inline_capacity_ : dyn_data.capacity();
     }
 
     // Check for emptiness
@@ -146,47 +275,51 @@ public:
 
     // Index access to the element
     reference operator[](size_type index) {
-        return const_cast<reference>(static_cast<const InlineVector&>(*this)[index]);
+        detach();
+        return const_cast<reference>(static_cast<const InlineVectorBase&>(*this)[index]);
     }
 
     const_reference operator[](size_type index) const {
         if (index >= size_) {
             throw std::out_of_range("`InlineVector::operator[]` index out of range");
         }
-        return size_ <= N ? sized_data[index] : dyn_data[index];
+        return size_ <= inline_capacity_ ? inline_data()[index] : dyn_data[index];
     }
 
     // First element access
     reference front() {
-        return const_cast<reference>(static_cast<const InlineVector&>(*this).front());
+        detach();
+        return const_cast<reference>(static_cast<const InlineVectorBase&>(*this).front());
     }
 
     const_reference front() const {
         if (size_ == 0) {
             throw std::out_of_range("`InlineVector::front()` vector is empty");
         }
-        return size_ <= N ? sized_data[0] : dyn_data[0];
+        return size_ <= inline_capacity_ ? inline_data()[0] : dyn_data[0];
     }
 
     // Last element access
     reference back() {
-        return const_cast<reference>(static_cast<const InlineVector&>(*this).back());
+        detach();
+        return const_cast<reference>(static_cast<const InlineVectorBase&>(*this).back());
     }
 
     const_reference back() const {
         if (size_ == 0) {
             throw std::out_of_range("`InlineVector::back()` vector is empty");
         }
-        return size_ <= N ? sized_data[size_ - 1] : dyn_data[size_ - 1];
+        return size_ <= inline_capacity_ ? inline_data()[size_ - 1] : dyn_data[size_ - 1];
     }
 
     // Adding element to the end
     void push_back(const_reference value) {
-        if (size_ < N) {
-            sized_data[size_++] = value;
+        detach();
+        if (size_ < inline_capacity_) {
+            inline_data()[size_++] = value;
         } else {
             dyn_data.reserve(size_ + 1);
-            if (size_ == N)
+            if (size_ == inline_capacity_)
                 sized_to_dyn();
             dyn_data[size_++] = value;
         }
@@ -197,54 +330,93 @@ public:
         if (size_ == 0) {
             throw std::out_of_range("`InlineVector::pop_back()` vector is empty");
         }
-        dyn_data.reserve(--size_);
-        if (size_ == N) {
-            dyn_to_sized();
-            dyn_data.clear();
-        }
+        truncate(size_ - 1);
     }
 
     // Iterator to the start of the vector
-    iterator begin() noexcept {
-        return size_ <= N ? sized_data.begin() : dyn_data.begin();
+    iterator begin() noexcept(!kCopyOnWrite) {
+        detach();
+        return size_ <= inline_capacity_ ? inline_data() : dyn_data.begin();
     }
 
     // Iterator to the end of the vector
-    iterator end() noexcept {
-        return size_ <= N ? sized_data.end() : dyn_data.end();
+    iterator end() noexcept(!kCopyOnWrite) {
+        detach();
+        return size_ <= inline_capacity_ ? inline_data() + size_ : dyn_data.end();
     }
 
     const_iterator begin() const noexcept {
-        return size_ <= N ? sized_data.begin() : dyn_data.begin();
+        return size_ <= inline_capacity_ ? inline_data() : dyn_data.begin();
     }
 
     const_iterator end() const noexcept {
-        return size_ <= N ? sized_data.end() : dyn_data.end();
+        return size_ <= inline_capacity_ ? inline_data() + size_ : dyn_data.end();
     }
 
     // Clear vector from elements
     void clear() noexcept {
-        if (size_ > N) {
+        if (size_ > inline_capacity_) {
             dyn_data.clear();
         }
         size_ = 0;
     }
 
+    // Change size, new elements are value-initialized
+    void resize(size_type count) {
+        detach();
+        if (count <= inline_capacity_) {
+            if (size_ > inline_capacity_)
+                truncate(count);
+            std::fill(inline_data() + std::min(size_, count), inline_data() + count, value_type());
+        } else {
+            dyn_data.reserve(count);
+            if (size_ <= inline_capacity_)
+                std::copy(inline_data(), inline_data() + size_, dyn_data.begin());
+            std::fill(dyn_data.begin() + std::min(size_, count), dyn_data.end(), value_type());
+        }
+        size_ = count;
+    }
+
+    // Grow by `count` elements and return a pointer to the first of them.
+    // New elements are default-initialized, so trivial types are left for the caller to overwrite.
+    pointer append_uninitialized(size_type count) {
+        detach();
+        size_type old_size = size_;
+        if (size_ + count > inline_capacity_) {
+            dyn_data.reserve(size_ + count);
+            if (size_ <= inline_capacity_)
+                std::copy(inline_data(), inline_data() + size_, dyn_data.begin());
+        }
+        size_ += count;
+        return begin() + old_size;
+    }
+
+    // Change size without value-initializing new elements
+    void resize_for_overwrite(size_type count) {
+        if (count <= size_) {
+            detach();
+            truncate(count);
+        } else {
+            append_uninitialized(count - size_);
+        }
+    }
+
     // Insert element at a given position
     iterator insert(const_iterator pos, const_reference value) {
-        size_type index = pos - begin();
+        size_type index = pos - std::as_const(*this).begin();
+        detach();
 
         if (index == size_) {
             push_back(value);
-        } else if (size_ < N) {
+        } else if (size_ < inline_capacity_) {
             for (size_type i = size_; i > index; --i) {
-                sized_data[i] = sized_data[i-1];
+                inline_data()[i] = inline_data()[i-1];
             }
             ++size_;
-            sized_data[index] = value;
+            inline_data()[index] = value;
         } else {
             dyn_data.reserve(size_ + 1);
-            if (size_ == N)
+            if (size_ == inline_capacity_)
                 sized_to_dyn();
             ++size_;
             std::copy(begin() + index, end(), begin() + index + 1);
@@ -256,25 +428,61 @@ public:
 
     // Erase element at a given position
     iterator erase(const_iterator pos) {
-        size_type index = pos - begin();
-        if (pos < begin() || pos >= end()) {
+        size_type index = pos - std::as_const(*this).begin();
+        if (index >= size_) {
             throw std::out_of_range("`InlineVector::erase` iterator out of range");
         }
-        if (pos == end() - 1) {
+        detach();
+        if (index == size_ - 1) {
             pop_back();
             return begin() + index;
         }
         std::move(begin() + index + 1, end(), begin() + index);
-        --size_;
-        if (size_ > N)
-            dyn_data.reserve(size_);
-        if (size_ == N)
-            dyn_to_sized();
+        truncate(size_ - 1);
+        return begin() + index;
+    }
+
+    // Erase element at a given position in O(1) by moving the last element into its place.
+    // The order of the remaining elements is not preserved.
+    iterator unordered_erase(const_iterator pos) {
+        size_type index = pos - std::as_const(*this).begin();
+        if (index >= size_) {
+            throw std::out_of_range("`InlineVector::unordered_erase` iterator out of range");
+        }
+        detach();
+        iterator data = begin();
+        if (index != size_ - 1)
+            data[index] = std::move(data[size_ - 1]);
+        truncate(size_ - 1);
         return begin() + index;
     }
 
+    // Remove all elements satisfying `pred` in a single pass, keeping the order of the rest.
+    // Storage mode changes at most once. Returns the number of removed elements.
+    template<class Predicate>
+    size_type remove_if(Predicate pred) {
+        detach();
+        size_type count;
+        if constexpr (std::is_arithmetic<T>::value) {
+            // Every value is stored and the output only advances when kept, so an
+            // unpredictable predicate costs no branch mispredictions
+            pointer out = begin();
+            for (pointer it = begin(), last = end(); it != last; ++it) {
+                T value = *it;
+                *out = value;
+                out += !pred(value);
+            }
+            count = out - begin();
+        } else {
+            count = std::remove_if(begin(), end(), pred) - begin();
+        }
+        size_type removed = size_ - count;
+        truncate(count);
+        return removed;
+    }
+
     // Equality check operator
-    friend bool operator==(const InlineVector<T, N, Allocator>& lhs, const InlineVector<T, N, Allocator>& rhs) {
+    friend bool operator==(const InlineVectorBase& lhs, const InlineVectorBase& rhs) {
         if (lhs.size() != rhs.size() || lhs.capacity() != rhs.capacity()) {
             return false;
         }
@@ -286,8 +494,107 @@ public:
         return true;
     }
 
+protected:
+    // Alignment of the derived class's inline buffer, the same as for heap blocks
+    static constexpr std::size_t kInlineAlignment = inline_vector_detail::AllocatorAlignment<Allocator>::value;
+
+    // The derived class places its inline buffer of N elements right after this base.
+    // N comes as a type so that `vec = {n}` cannot convert through this constructor.
+    template<size_type N>
+    explicit InlineVectorBase(std::integral_constant<size_type, N>) noexcept : size_(0), inline_capacity_(N) {}
+
+    InlineVectorBase(const InlineVectorBase&) = delete;
+
+    // Destructor, not virtual: vectors are never deleted through the base
+    ~InlineVectorBase() {
+        clear();
+    }
+
+    // Copy elements of `other`, spilled vectors share the heap block under CopyOnWrite
+    void copy_from(const InlineVectorBase& other) {
+        if (this == &other) {
+            return;
+        }
+        if (kCopyOnWrite && other.size_ > other.inline_capacity_ && other.size_ > inline_capacity_) {
+            size_ = other.size_;
+            dyn_data.share(other.dyn_data);
+            return;
+        }
+        if (size_ > inline_capacity_)
+            dyn_data.clear();
+        size_ = other.size_;
+        if (size_ > inline_capacity_)
+            dyn_data.reserve(size_);
+        std::copy(other.begin(), other.end(), begin());
+    }
+
 private:
+    // The inline buffer starts at the first suitably aligned byte past the base, as in LLVM's
+    // SmallVector. Computing it instead of storing a pointer keeps the object smaller and
+    // free of self-references. The integer round trip keeps GCC's -Warray-bounds from tying
+    // heap-sized offsets to the inline branch of begin().
+    pointer inline_data() const noexcept {
+        constexpr std::size_t kOffset = (sizeof(InlineVectorBase) + kInlineAlignment - 1) / kInlineAlignment
+                                        * kInlineAlignment;
+        return reinterpret_cast<pointer>(reinterpret_cast<std::uintptr_t>(this) + kOffset);
+    }
+
     size_type size_;
+    size_type inline_capacity_;
     DynData dyn_data;
-    std::array<value_type, N> sized_data;
-};
\ No newline at end of file
+};
+
+// Inline buffer with the requested alignment
+template<class T, std::size_t N, std::size_t Alignment = alignof(T)>
+struct InlineStorage {
+    alignas(Alignment) std::array<T, N> sized_data;
+};
+
+// `Alignment` applies to the inline buffer and to heap blocks. Stronger than natural
+// alignment wraps the allocator into AlignedAllocator, which changes the base type.
+template<class T, std::size_t N, class Allocator = std::allocator<T>, class CopyPolicy = DeepCopy,
+         std::size_t Alignment = alignof(T)>
+class InlineVector : public InlineVectorBase<T, inline_vector_detail::aligned_allocator_t<T, Allocator, Alignment>,
+                                             CopyPolicy> {
+
+    using Base = InlineVectorBase<T, inline_vector_detail::aligned_allocator_t<T, Allocator, Alignment>, CopyPolicy>;
+
+public:
+    // Simple constructor
+    InlineVector() noexcept : Base(std::integral_constant<std::size_t, N>()) {}
+
+    // Initializer list constructor
+    InlineVector(std::initializer_list<T> list) : InlineVector() {
+        for (auto i : list) {
+            this->push_back(i);
+        }
+    }
+
+    // Copy constructor
+    InlineVector(const InlineVector& other) : InlineVector() {
+        this->copy_from(other);
+    }
+
+    // Copy from a vector with any inline capacity
+    explicit InlineVector(const Base& other) : InlineVector() {
+        this->copy_from(other);
+    }
+
+    // Assignment operator
+    InlineVector& operator=(const InlineVector& other) {
+        this->copy_from(other);
+        return *this;
+    }
+
+    using Base::operator=;
+
+private:
+    // Must stay the first member: InlineVectorBase::inline_data() finds it right after the base
+    InlineStorage<T, N, Base::kInlineAlignment> storage_;
+};
+
+// Remove all elements satisfying `pred`, returns the number of removed elements
+template<class T, class Allocator, class CopyPolicy, class Predicate>
+std::size_t erase_if(InlineVectorBase<T, Allocator, CopyPolicy>& vec, Predicate pred) {
+    return vec.remove_if(pred);
+}
\ No newline at end of file
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "inline_vector/inline_vector.hpp"
+
+// Read-only view of a contiguous run of elements with the InlineVector read API
+template<class T>
+class InlineVectorView {
+
+public:
+    // Aliases for types
+    using size_type = std::size_t;
+    using value_type = T;
+    using const_pointer = const T*;
+    using const_reference = const T&;
+    using const_iterator = const T*;
+    using iterator = const_iterator;
+
+    InlineVectorView() noexcept : data_(nullptr), size_(0) {}
+    InlineVectorView(const_pointer data, size_type size) noexcept : data_(data), size_(size) {}
+
+    // View size
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    // Check for emptiness
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Index access to the element
+    const_reference operator[](size_type index) const {
+        if (index >= size_) {
+            throw std::out_of_range("`InlineVectorView::operator[]` index out of range");
+        }
+        return data_[index];
+    }
+
+    // First element access
+    const_reference front() const {
+        if (size_ == 0) {
+            throw std::out_of_range("`InlineVectorView::front()` view is empty");
+        }
+        return data_[0];
+    }
+
+    // Last element access
+    const_reference back() const {
+        if (size_ == 0) {
+            throw std::out_of_range("`InlineVectorView::back()` view is empty");
+        }
+        return data_[size_ - 1];
+    }
+
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+    const_pointer data() const noexcept { return data_; }
+
+    // Equality check operator, compares elements only
+    friend bool operator==(const InlineVectorView& lhs, const InlineVectorView& rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend bool operator!=(const InlineVectorView& lhs, const InlineVectorView& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    const_pointer data_;
+    size_type size_;
+};
+
+// Many small vectors packed into one buffer (compressed sparse row layout).
+// Row i occupies values_[offsets_[i], offsets_[i + 1]), rows are appended and then read.
+template<class T, class Allocator = std::allocator<T>>
+class InlineVectorArray {
+
+    using OffsetAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::size_t>;
+
+public:
+    // Aliases for types
+    using size_type = std::size_t;
+    using value_type = T;
+    using const_reference = const T&;
+    using row_type = InlineVectorView<T>;
+
+    // Iterator over rows
+    class const_iterator {
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = row_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = row_type;
+
+        const_iterator() noexcept : owner_(nullptr), index_(0) {}
+        const_iterator(const InlineVectorArray* owner, size_type index) noexcept : owner_(owner), index_(index) {}
+
+        row_type operator*() const { return owner_->row(index_); }
+        row_type operator[](difference_type offset) const { return owner_->row(index_ + offset); }
+
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) { const_iterator copy = *this; ++index_; return copy; }
+        const_iterator& operator--() { --index_; return *this; }
+        const_iterator operator--(int) { const_iterator copy = *this; --index_; return copy; }
+        const_iterator& operator+=(difference_type offset) { index_ += offset; return *this; }
+        const_iterator& operator-=(difference_type offset) { index_ -= offset; return *this; }
+        const_iterator operator+(difference_type offset) const { return const_iterator(owner_, index_ + offset); }
+        const_iterator operator-(difference_type offset) const { return const_iterator(owner_, index_ - offset); }
+
+        difference_type operator-(const const_iterator& other) const {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+        }
+
+        bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+        bool operator<(const const_iterator& other) const { return index_ < other.index_; }
+        bool operator>(const const_iterator& other) const { return index_ > other.index_; }
+        bool operator<=(const const_iterator& other) const { return index_ <= other.index_; }
+        bool operator>=(const const_iterator& other) const { return index_ >= other.index_; }
+
+        friend const_iterator operator+(difference_type offset, const const_iterator& it) { return it + offset; }
+
+    private:
+        const InlineVectorArray* owner_;
+        size_type index_;
+    };
+
+    using iterator = const_iterator;
+
+    // Simple constructor
+    InlineVectorArray() : offsets_(1, 0) {}
+
+    // Build from a range of rows, e.g. InlineVectors, in two passes so storage is allocated once.
+    // The range is walked twice, so single-pass input iterators are not accepted.
+    template<class ForwardIt>
+    InlineVectorArray(ForwardIt first, ForwardIt last) : InlineVectorArray() {
+        size_type rows = 0;
+        size_type elements = 0;
+        for (ForwardIt it = first; it != last; ++it) {
+            ++rows;
+            elements += it->size();
+        }
+        reserve(rows, elements);
+        for (; first != last; ++first) {
+            push_row(*first);
+        }
+    }
+
+    // Initializer list constructor, one list per row
+    InlineVectorArray(std::initializer_list<std::initializer_list<T>> rows)
+        : InlineVectorArray(rows.begin(), rows.end()) {}
+
+    // Number of rows
+    size_type size() const noexcept {
+        return offsets_.size() - 1;
+    }
+
+    // Number of elements in all rows
+    size_type total_size() const noexcept {
+        return values_.size();
+    }
+
+    // Check for emptiness
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    // Row access
+    row_type operator[](size_type index) const {
+        if (index >= size()) {
+            throw std::out_of_range("`InlineVectorArray::operator[]` index out of range");
+        }
+        return row(index);
+    }
+
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, size()); }
+
+    // Preallocate room for rows and elements
+    void reserve(size_type rows, size_type elements) {
+        offsets_.reserve(rows + 1);
+        values_.reserve(elements);
+    }
+
+    // Append a whole row, anything with begin() and end()
+    template<class Row>
+    void push_row(const Row& row) {
+        values_.insert(values_.end(), std::begin(row), std::end(row));
+        offsets_.push_back(values_.size());
+    }
+
+    void push_row(std::initializer_list<T> row) {
+        push_row<std::initializer_list<T>>(row);
+    }
+
+    // Start an empty row for streaming appends
+    void start_row() {
+        offsets_.push_back(values_.size());
+    }
+
+    // Append an element to the last row
+    void push_back(const_reference value) {
+        if (empty()) {
+            throw std::out_of_range("`InlineVectorArray::push_back()` no row started");
+        }
+        values_.push_back(value);
+        ++offsets_.back();
+    }
+
+    // Remove all rows
+    void clear() noexcept {
+        values_.clear();
+        offsets_.assign(1, 0);
+    }
+
+    // Bytes held by the object and its buffers
+    size_type memory_usage() const noexcept {
+        return sizeof(*this) + values_.capacity() * sizeof(T) + offsets_.capacity() * sizeof(size_type);
+    }
+
+    // Equality check operator
+    friend bool operator==(const InlineVectorArray& lhs, const InlineVectorArray& rhs) {
+        return lhs.offsets_ == rhs.offsets_ && lhs.values_ == rhs.values_;
+    }
+
+    friend bool operator!=(const InlineVectorArray& lhs, const InlineVectorArray& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    row_type row(size_type index) const noexcept {
+        return row_type(values_.data() + offsets_[index], offsets_[index + 1] - offsets_[index]);
+    }
+
+    std::vector<T, Allocator> values_;
+    std::vector<size_type, OffsetAllocator> offsets_;
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <istream>
+#include <type_traits>
+
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "inline_vector/inline_vector.hpp"
+
+// Reading straight into the tail of a byte vector. Each call grows the vector once by
+// `count`, reads into the new tail and trims it to the number of bytes actually read,
+// so no intermediate buffer or value-initialization is involved.
+
+namespace inline_vector_detail {
+
+template<class T>
+constexpr bool kByteLike = sizeof(T) == 1 && std::is_trivially_copyable<T>::value;
+
+// Run read_fn(tail, count) on a fresh tail of `count` elements and keep what it reports
+template<class T, class Allocator, class CopyPolicy, class ReadFn>
+auto read_into_tail(InlineVectorBase<T, Allocator, CopyPolicy>& vec, std::size_t count, ReadFn read_fn) {
+    static_assert(kByteLike<T>, "reading into InlineVector requires a byte-sized element type");
+    std::size_t old_size = vec.size();
+    T* tail = vec.append_uninitialized(count);
+    decltype(read_fn(tail, count)) result;
+    try {
+        result = read_fn(tail, count);
+    } catch (...) {
+        vec.resize_for_overwrite(old_size);
+        throw;
+    }
+    vec.resize_for_overwrite(old_size + (result > 0 ? static_cast<std::size_t>(result) : 0));
+    return result;
+}
+
+}  // namespace inline_vector_detail
+
+// Append up to `count` bytes read from `fd`. Returns the result of read(2):
+// the number of bytes appended, 0 at end of file or -1 with errno set.
+template<class T, class Allocator, class CopyPolicy>
+ssize_t read_append(int fd, InlineVectorBase<T, Allocator, CopyPolicy>& vec, std::size_t count) {
+    return inline_vector_detail::read_into_tail(vec, count, [fd](T* tail, std::size_t size) {
+        return ::read(fd, tail, size);
+    });
+}
+
+// Append up to `count` bytes read from `fd` at `offset`, the file position is not changed
+template<class T, class Allocator, class CopyPolicy>
+ssize_t pread_append(int fd, InlineVectorBase<T, Allocator, CopyPolicy>& vec, std::size_t count, off_t offset) {
+    return inline_vector_detail::read_into_tail(vec, count, [fd, offset](T* tail, std::size_t size) {
+        return ::pread(fd, tail, size, offset);
+    });
+}
+
+// Append up to `count` characters read from `in`, returns the number appended
+template<class T, class Allocator, class CopyPolicy>
+std::size_t read_append(std::istream& in, InlineVectorBase<T, Allocator, CopyPolicy>& vec, std::size_t count) {
+    return inline_vector_detail::read_into_tail(vec, count, [&in](T* tail, std::size_t size) {
+        in.read(reinterpret_cast<char*>(tail), static_cast<std::streamsize>(size));
+        return static_cast<std::size_t>(in.gcount());
+    });
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "inline_vector/inline_vector.hpp"
+
+// Vectors shorter than this are processed serially by default. Every call (and every merge
+// level of parallel_sort) starts fresh threads, which costs tens of microseconds per worker.
+constexpr std::size_t kParallelThreshold = 1 << 16;
+
+namespace inline_vector_detail {
+
+// Number of workers for a given request (0 means all hardware threads)
+inline std::size_t worker_count(std::size_t threads, std::size_t size) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    return std::max<std::size_t>(1, std::min(threads, size));
+}
+
+// Split [0, size) into `chunks` contiguous parts and run fn(chunk, first, last) on each.
+// Chunk 0 runs on the calling thread, exceptions are rethrown after join. If a thread cannot
+// be started, the ones already running are joined before the error propagates.
+template<class Fn>
+void parallel_chunks(std::size_t size, std::size_t chunks, Fn fn) {
+    std::vector<std::thread> workers;
+    std::vector<std::exception_ptr> errors(chunks);
+    workers.reserve(chunks - 1);
+
+    auto run = [&](std::size_t chunk) {
+        try {
+            fn(chunk, size * chunk / chunks, size * (chunk + 1) / chunks);
+        } catch (...) {
+            errors[chunk] = std::current_exception();
+        }
+    };
+
+    auto join_all = [&] {
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    };
+
+    try {
+        for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+            workers.emplace_back(run, chunk);
+        }
+    } catch (...) {
+        join_all();
+        throw;
+    }
+    run(0);
+    join_all();
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+// Merge path co-rank: number of elements taken from `a` among the first k outputs of a stable
+// merge of a[0, a_size) and b[0, b_size), where ties go to `a`
+template<class T, class Compare>
+std::size_t co_rank(std::size_t k, const T* a, std::size_t a_size, const T* b, std::size_t b_size,
+                    Compare& comp) {
+    std::size_t low = k > b_size ? k - b_size : 0;
+    std::size_t high = std::min(k, a_size);
+    while (low < high) {
+        std::size_t i = low + (high - low) / 2;
+        // a[i] precedes b[k - i - 1] in the merge, so more than i elements come from a
+        if (!comp(b[k - i - 1], a[i])) {
+            low = i + 1;
+        } else {
+            high = i;
+        }
+    }
+    return low;
+}
+
+// Write outputs [first, last) of the stable merge of a and b to out + first
+template<class T, class Compare>
+void merge_slice(const T* a, std::size_t a_size, const T* b, std::size_t b_size,
+                 std::size_t first, std::size_t last, T* out, Compare& comp) {
+    std::size_t a_first = co_rank(first, a, a_size, b, b_size, comp);
+    std::size_t a_last = co_rank(last, a, a_size, b, b_size, comp);
+    std::merge(a + a_first, a + a_last, b + (first - a_first), b + (last - a_last), out + first, comp);
+}
+
+// Whether an operation over the vector should go parallel
+template<class Vector>
+bool use_parallel(const Vector& vec, std::size_t threshold, std::size_t threads) {
+    return vec.size() > vec.inline_capacity() && vec.size() >= threshold && worker_count(threads, vec.size()) > 1;
+}
+
+}  // namespace inline_vector_detail
+
+// Assign `value` to every element
+template<class T, class Allocator, class CopyPolicy>
+void parallel_fill(InlineVectorBase<T, Allocator, CopyPolicy>& vec, const T& value,
+                   std::size_t threshold = kParallelThreshold, std::size_t threads = 0) {
+    if (!inline_vector_detail::use_parallel(vec, threshold, threads)) {
+        std::fill(vec.begin(), vec.end(), value);
+        return;
+    }
+    T* data = vec.begin();
+    inline_vector_detail::parallel_chunks(vec.size(), inline_vector_detail::worker_count(threads, vec.size()),
+        [&](std::size_t, std::size_t first, std::size_t last) {
+            std::fill(data + first, data + last, value);
+        });
+}
+
+// Replace every element with op(element)
+template<class T, class Allocator, class CopyPolicy, class UnaryOp>
+void parallel_transform(InlineVectorBase<T, Allocator, CopyPolicy>& vec, UnaryOp op,
+                        std::size_t threshold = kParallelThreshold, std::size_t threads = 0) {
+    if (!inline_vector_detail::use_parallel(vec, threshold, threads)) {
+        std::transform(vec.begin(), vec.end(), vec.begin(), op);
+        return;
+    }
+    T* data = vec.begin();
+    inline_vector_detail::parallel_chunks(vec.size(), inline_vector_detail::worker_count(threads, vec.size()),
+        [&](std::size_t, std::size_t first, std::size_t last) {
+            std::transform(data + first, data + last, data + first, op);
+        });
+}
+
+// Sort chunks independently, then merge neighbouring runs pairwise. Every merge level is split
+// into equal output slices by co-ranking, so all workers stay busy up to the last level.
+template<class T, class Allocator, class CopyPolicy, class Compare = std::less<T>>
+void parallel_sort(InlineVectorBase<T, Allocator, CopyPolicy>& vec, Compare comp = Compare(),
+                   std::size_t threshold = kParallelThreshold, std::size_t threads = 0) {
+    if (!inline_vector_detail::use_parallel(vec, threshold, threads)) {
+        std::sort(vec.begin(), vec.end(), comp);
+        return;
+    }
+    T* data = vec.begin();
+    const std::size_t size = vec.size();
+    const std::size_t chunks = inline_vector_detail::worker_count(threads, size);
+
+    inline_vector_detail::parallel_chunks(size, chunks,
+        [&](std::size_t, std::size_t first, std::size_t last) {
+            std::sort(data + first, data + last, comp);
+        });
+
+    // Run boundaries must match the ones used by parallel_chunks
+    std::vector<std::size_t> bounds(chunks + 1);
+    for (std::size_t chunk = 0; chunk <= chunks; ++chunk) {
+        bounds[chunk] = size * chunk / chunks;
+    }
+    // Levels alternate between the vector and a buffer of the same size
+    std::vector<T> buffer(size);
+    T* source = data;
+    T* target = buffer.data();
+    for (std::size_t width = 1; width < chunks; width *= 2) {
+        inline_vector_detail::parallel_chunks(size, chunks,
+            [&](std::size_t, std::size_t first, std::size_t last) {
+                for (std::size_t left = 0; left < chunks; left += 2 * width) {
+                    std::size_t begin = bounds[left];
+                    std::size_t mid = bounds[std::min(left + width, chunks)];
+                    std::size_t end = bounds[std::min(left + 2 * width, chunks)];
+                    if (end <= first || begin >= last) {
+                        continue;
+                    }
+                    inline_vector_detail::merge_slice(source + begin, mid - begin, source + mid, end - mid,
+                                                      std::max(first, begin) - begin,
+                                                      std::min(last, end) - begin, target + begin, comp);
+                }
+            });
+        std::swap(source, target);
+    }
+    if (source != data) {
+        inline_vector_detail::parallel_chunks(size, chunks,
+            [&](std::size_t, std::size_t first, std::size_t last) {
+                std::copy(source + first, source + last, data + first);
+            });
+    }
+}
+
+// Fold all elements with an associative `op`, starting from `init`
+template<class T, class Allocator, class CopyPolicy, class R, class BinaryOp = std::plus<>>
+R parallel_reduce(const InlineVectorBase<T, Allocator, CopyPolicy>& vec, R init, BinaryOp op = BinaryOp(),
+                  std::size_t threshold = kParallelThreshold, std::size_t threads = 0) {
+    if (!inline_vector_detail::use_parallel(vec, threshold, threads)) {
+        return std::accumulate(vec.begin(), vec.end(), init, op);
+    }
+    const T* data = vec.begin();
+    const std::size_t chunks = inline_vector_detail::worker_count(threads, vec.size());
+    std::vector<R> partial(chunks);
+
+    // Each chunk is non-empty, so it is seeded with its own first element
+    inline_vector_detail::parallel_chunks(vec.size(), chunks,
+        [&](std::size_t chunk, std::size_t first, std::size_t last) {
+            partial[chunk] = std::accumulate(data + first + 1, data + last, R(data[first]), op);
+        });
+
+    return std::accumulate(partial.begin(), partial.end(), init, op);
+}
@@ -0,0 +1,325 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "inline_vector/inline_vector.hpp"
+#include "inline_vector/segments.hpp"
+
+// InlineVector with stable-reference growth.
+// After the inline block elements go to segments of size N * 2^k that are appended
+// instead of relocated, so pointers and iterators to elements survive any push_back.
+template<class T, std::size_t N, class Allocator = std::allocator<T>>
+class SegmentedInlineVector {
+
+    // Random access iterator that walks the inline block and then the segments
+    template<class Value>
+    class Iterator {
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        Iterator() noexcept : owner_(nullptr), index_(0), current_(nullptr), block_end_(nullptr) {}
+
+        Iterator(const SegmentedInlineVector* owner, std::size_t index) noexcept
+            : owner_(owner), index_(index) {
+            locate();
+        }
+
+        // iterator converts to const_iterator
+        template<class Other, class = std::enable_if_t<std::is_const<Value>::value && !std::is_const<Other>::value>>
+        Iterator(const Iterator<Other>& other) noexcept : Iterator(other.owner_, other.index_) {}
+
+        reference operator*() const { return *current_; }
+        pointer operator->() const { return current_; }
+        reference operator[](difference_type offset) const { return *(*this + offset); }
+
+        // Stepping stays inside the current block and only relocates at its end
+        Iterator& operator++() {
+            ++index_;
+            if (++current_ == block_end_) {
+                locate();
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        Iterator& operator--() {
+            --index_;
+            locate();
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator copy = *this;
+            --*this;
+            return copy;
+        }
+
+        Iterator& operator+=(difference_type offset) {
+            index_ += offset;
+            locate();
+            return *this;
+        }
+
+        Iterator& operator-=(difference_type offset) { return *this += -offset; }
+        Iterator operator+(difference_type offset) const { return Iterator(*this) += offset; }
+        Iterator operator-(difference_type offset) const { return Iterator(*this) -= offset; }
+        friend Iterator operator+(difference_type offset, const Iterator& it) { return it + offset; }
+
+        difference_type operator-(const Iterator& other) const {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+        }
+
+        bool operator==(const Iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const Iterator& other) const { return index_ != other.index_; }
+        bool operator<(const Iterator& other) const { return index_ < other.index_; }
+        bool operator>(const Iterator& other) const { return index_ > other.index_; }
+        bool operator<=(const Iterator& other) const { return index_ <= other.index_; }
+        bool operator>=(const Iterator& other) const { return index_ >= other.index_; }
+
+    private:
+        template<class> friend class Iterator;
+
+        void locate() noexcept {
+            T* current = nullptr;
+            T* block_end = nullptr;
+            owner_->locate(index_, current, block_end);
+            current_ = current;
+            block_end_ = block_end;
+        }
+
+        const SegmentedInlineVector* owner_;
+        std::size_t index_;
+        Value* current_;
+        Value* block_end_;
+    };
+
+public:
+    // Aliases for types
+    using size_type = std::size_t;
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+
+    // Simple constructor
+    SegmentedInlineVector() noexcept : size_(0), segment_count_(0), segments_{} {}
+
+    // Initializer list constructor
+    SegmentedInlineVector(std::initializer_list<value_type> list) : SegmentedInlineVector() {
+        for (auto i : list) {
+            push_back(i);
+        }
+    }
+
+    // Copy constructor
+    SegmentedInlineVector(const SegmentedInlineVector& other) : SegmentedInlineVector() {
+        for (const auto& value : other) {
+            push_back(value);
+        }
+    }
+
+    // Assignment operator
+    SegmentedInlineVector& operator=(const SegmentedInlineVector& other) {
+        if (this != &other) {
+            clear();
+            for (const auto& value : other) {
+                push_back(value);
+            }
+        }
+        return *this;
+    }
+
+    // Destructor
+    ~SegmentedInlineVector() {
+        clear();
+    }
+
+    // Vector size
+    size_type size() const noexcept {
+        return size_;
+    }
+
+    // Inline slots plus all allocated segments
+    size_type capacity() const noexcept {
+        return N + inline_vector_detail::segment_start(segment_count_, kSegmentBase);
+    }
+
+    // Check for emptiness
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Index access to the element
+    reference operator[](size_type index) {
+        return const_cast<reference>(static_cast<const SegmentedInlineVector&>(*this)[index]);
+    }
+
+    const_reference operator[](size_type index) const {
+        if (index >= size_) {
+            throw std::out_of_range("`SegmentedInlineVector::operator[]` index out of range");
+        }
+        if (index < N) {
+            return inline_data_[index];
+        }
+        auto position = inline_vector_detail::segment_position(index - N, kSegmentBase);
+        return segments_[position.segment][position.offset];
+    }
+
+    // First element access
+    reference front() {
+        return const_cast<reference>(static_cast<const SegmentedInlineVector&>(*this).front());
+    }
+
+    const_reference front() const {
+        if (size_ == 0) {
+            throw std::out_of_range("`SegmentedInlineVector::front()` vector is empty");
+        }
+        return (*this)[0];
+    }
+
+    // Last element access
+    reference back() {
+        return const_cast<reference>(static_cast<const SegmentedInlineVector&>(*this).back());
+    }
+
+    const_reference back() const {
+        if (size_ == 0) {
+            throw std::out_of_range("`SegmentedInlineVector::back()` vector is empty");
+        }
+        return (*this)[size_ - 1];
+    }
+
+    // Adding element to the end, appends a new segment instead of relocating
+    void push_back(const_reference value) {
+        if (size_ == capacity()) {
+            add_segment();
+        }
+        ++size_;
+        back() = value;
+    }
+
+    // Deleting last element, segments are kept until clear()
+    void pop_back() {
+        if (size_ == 0) {
+            throw std::out_of_range("`SegmentedInlineVector::pop_back()` vector is empty");
+        }
+        --size_;
+    }
+
+    // Iterators over all elements
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size_); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+    // Clear vector from elements and release segments
+    void clear() noexcept {
+        for (size_type segment = 0; segment < segment_count_; ++segment) {
+            size_type count = inline_vector_detail::segment_size(segment, kSegmentBase);
+            std::destroy_n(segments_[segment], count);
+            allocator_.deallocate(segments_[segment], count);
+            segments_[segment] = nullptr;
+        }
+        segment_count_ = 0;
+        size_ = 0;
+    }
+
+    // Insert element at a given position, shifts values but not storage
+    iterator insert(const_iterator pos, const_reference value) {
+        size_type index = pos - begin();
+        if (index > size_) {
+            throw std::out_of_range("`SegmentedInlineVector::insert` iterator out of range");
+        }
+        push_back(value);
+        std::rotate(begin() + index, end() - 1, end());
+        return begin() + index;
+    }
+
+    // Erase element at a given position
+    iterator erase(const_iterator pos) {
+        size_type index = pos - begin();
+        if (index >= size_) {
+            throw std::out_of_range("`SegmentedInlineVector::erase` iterator out of range");
+        }
+        std::move(begin() + index + 1, end(), begin() + index);
+        pop_back();
+        return begin() + index;
+    }
+
+    // Contiguous copy of the elements
+    InlineVector<T, N, Allocator> flatten() const {
+        InlineVector<T, N, Allocator> result;
+        for (const auto& value : *this) {
+            result.push_back(value);
+        }
+        return result;
+    }
+
+    // Equality check operator
+    friend bool operator==(const SegmentedInlineVector& lhs, const SegmentedInlineVector& rhs) {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend bool operator!=(const SegmentedInlineVector& lhs, const SegmentedInlineVector& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    static constexpr size_type kSegmentBase = N > 0 ? N : 1;
+
+    // Slots are default-initialised, push_back assigns over them, so trivial types are not zeroed
+    void add_segment() {
+        size_type count = inline_vector_detail::segment_size(segment_count_, kSegmentBase);
+        pointer data = allocator_.allocate(count);
+        try {
+            std::uninitialized_default_construct_n(data, count);
+        } catch (...) {
+            allocator_.deallocate(data, count);
+            throw;
+        }
+        segments_[segment_count_++] = data;
+    }
+
+    // Element at `index` and the end of the block holding it.
+    // Positions past the allocated storage yield null pointers.
+    void locate(size_type index, pointer& current, pointer& block_end) const noexcept {
+        if (index < N) {
+            pointer block = const_cast<pointer>(inline_data_.data());
+            current = block + index;
+            block_end = block + N;
+            return;
+        }
+        auto position = inline_vector_detail::segment_position(index - N, kSegmentBase);
+        if (position.segment >= segment_count_) {
+            current = block_end = nullptr;
+            return;
+        }
+        current = segments_[position.segment] + position.offset;
+        block_end = segments_[position.segment] + inline_vector_detail::segment_size(position.segment, kSegmentBase);
+    }
+
+    size_type size_;
+    size_type segment_count_;
+    std::array<pointer, inline_vector_detail::kMaxSegments> segments_;
+    Allocator allocator_;
+    std::array<value_type, N> inline_data_;
+};
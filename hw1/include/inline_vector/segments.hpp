@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+
+namespace inline_vector_detail {
+
+// Enough segments to address any size_type index
+constexpr std::size_t kMaxSegments = sizeof(std::size_t) * 8;
+
+// Index of the highest set bit, value must be non-zero
+inline std::size_t floor_log2(std::size_t value) noexcept {
+#if defined(__GNUC__)
+    return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(value);
+#else
+    std::size_t result = 0;
+    while (value >>= 1) {
+        ++result;
+    }
+    return result;
+#endif
+}
+
+// Location of an element inside geometrically growing segments
+struct SegmentPosition {
+    std::size_t segment;
+    std::size_t offset;
+};
+
+// Segment s holds `base << s` elements, so segments never move once allocated
+inline std::size_t segment_size(std::size_t segment, std::size_t base) noexcept {
+    return base << segment;
+}
+
+// Number of elements stored before segment s
+inline std::size_t segment_start(std::size_t segment, std::size_t base) noexcept {
+    return base * ((std::size_t(1) << segment) - 1);
+}
+
+inline SegmentPosition segment_position(std::size_t index, std::size_t base) noexcept {
+    std::size_t segment = floor_log2(index / base + 1);
+    return {segment, index - segment_start(segment, base)};
+}
+
+}  // namespace inline_vector_detail
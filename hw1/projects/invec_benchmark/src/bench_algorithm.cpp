@@ -0,0 +1,84 @@
+#include "benchmark.hpp"
+#include "inline_vector/algorithm.hpp"
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace {
+
+constexpr std::size_t kVectors = 100000;
+
+// Many small vectors filled up to N with values that produce duplicates
+template<std::size_t N>
+void run(const BenchConfig& config) {
+    using Vector = InlineVector<std::uint32_t, N>;
+    std::vector<Vector> source(kVectors), work;
+    std::mt19937 rng(42);
+    for (auto& vec : source) {
+        std::size_t size = 1 + rng() % N;
+        for (std::size_t i = 0; i < size; ++i) {
+            vec.push_back(rng() % (2 * N));
+        }
+    }
+
+    double ns = measure_ns(config.repeats, [&] { work = source; }, [&] {
+        for (auto& vec : work) {
+            std::sort(vec.begin(), vec.end());
+            vec.resize(std::unique(vec.begin(), vec.end()) - vec.begin());
+        }
+    });
+    print_row("algorithm", "std_sort_unique", kVectors, N, ns, kVectors);
+
+    ns = measure_ns(config.repeats, [&] { work = source; }, [&] {
+        for (auto& vec : work) {
+            sort(vec);
+            unique(vec);
+        }
+    });
+    print_row("algorithm", "inline_sort_unique", kVectors, N, ns, kVectors);
+
+    std::size_t total = 0;
+    ns = measure_ns(config.repeats, [&] {
+        for (std::size_t i = 0; i + 1 < work.size(); ++i) {
+            Vector result;
+            std::set_intersection(work[i].begin(), work[i].end(), work[i + 1].begin(), work[i + 1].end(),
+                                  std::back_inserter(result));
+            total += result.size();
+        }
+    });
+    print_row("algorithm", "std_set_intersection", kVectors, N, ns, kVectors);
+
+    ns = measure_ns(config.repeats, [&] {
+        for (std::size_t i = 0; i + 1 < work.size(); ++i) {
+            total += set_intersection(work[i], work[i + 1]).size();
+        }
+    });
+    print_row("algorithm", "inline_set_intersection", kVectors, N, ns, kVectors);
+
+    ns = measure_ns(config.repeats, [&] {
+        for (std::size_t i = 0; i + 1 < work.size(); ++i) {
+            Vector result;
+            std::set_union(work[i].begin(), work[i].end(), work[i + 1].begin(), work[i + 1].end(),
+                           std::back_inserter(result));
+            total += result.size();
+        }
+    });
+    print_row("algorithm", "std_set_union", kVectors, N, ns, kVectors);
+
+    ns = measure_ns(config.repeats, [&] {
+        for (std::size_t i = 0; i + 1 < work.size(); ++i) {
+            total += set_union(work[i], work[i + 1]).size();
+        }
+    });
+    print_row("algorithm", "inline_set_union", kVectors, N, ns, kVectors);
+    do_not_optimize(total);
+}
+
+}  // namespace
+
+void bench_algorithm(const BenchConfig& config) {
+    run<8>(config);
+    run<16>(config);
+    run<32>(config);
+}
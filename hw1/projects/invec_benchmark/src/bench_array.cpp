@@ -0,0 +1,75 @@
+#include "benchmark.hpp"
+#include "inline_vector/inline_vector_array.hpp"
+
+#include <random>
+
+namespace {
+
+constexpr std::size_t kInline = 8;
+
+// Row lengths up to 2N, so about half of the rows spill
+constexpr std::size_t kMaxRow = 2 * kInline;
+
+using Row = InlineVector<std::uint32_t, kInline>;
+
+std::size_t heap_bytes(const std::vector<Row>& rows) {
+    std::size_t bytes = sizeof(rows) + rows.capacity() * sizeof(Row);
+    for (const auto& row : rows) {
+        if (row.size() > row.inline_capacity()) {
+            bytes += row.capacity() * sizeof(std::uint32_t);
+        }
+    }
+    return bytes;
+}
+
+}  // namespace
+
+// Memory rows report bytes in the total_ns column and bytes per element in ns_per_op
+void bench_array(const BenchConfig& config) {
+    for (std::size_t size : bench_sizes(config)) {
+        std::mt19937 rng(42);
+        std::vector<Row> rows;
+        rows.reserve(size / kInline);
+        std::size_t elements = 0;
+        for (std::size_t i = 0; i < size / kInline; ++i) {
+            std::size_t length = rng() % (kMaxRow + 1);
+            rows.emplace_back();
+            for (std::size_t j = 0; j < length; ++j) {
+                rows.back().push_back(static_cast<std::uint32_t>(rng()));
+            }
+            elements += length;
+        }
+        InlineVectorArray<std::uint32_t> array(rows.begin(), rows.end());
+
+        print_row("array", "vector_of_inline_bytes", size, kInline, heap_bytes(rows), elements);
+        print_row("array", "packed_bytes", size, kInline, array.memory_usage(), elements);
+
+        double ns = measure_ns(config.repeats, [&] {
+            std::uint64_t sum = 0;
+            for (const auto& row : rows) {
+                for (auto value : row) {
+                    sum += value;
+                }
+            }
+            do_not_optimize(sum);
+        });
+        print_row("array", "vector_of_inline_scan", size, kInline, ns, elements);
+
+        ns = measure_ns(config.repeats, [&] {
+            std::uint64_t sum = 0;
+            for (auto row : array) {
+                for (auto value : row) {
+                    sum += value;
+                }
+            }
+            do_not_optimize(sum);
+        });
+        print_row("array", "packed_scan", size, kInline, ns, elements);
+
+        ns = measure_ns(config.repeats, [&] {
+            InlineVectorArray<std::uint32_t> built(rows.begin(), rows.end());
+            do_not_optimize(built.total_size());
+        });
+        print_row("array", "packed_build", size, kInline, ns, elements);
+    }
+}
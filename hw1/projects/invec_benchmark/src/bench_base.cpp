@@ -0,0 +1,72 @@
+#include "benchmark.hpp"
+#include "inline_vector/inline_vector.hpp"
+
+#include <utility>
+
+namespace {
+
+// Call-heavy workload. Instantiated once for InlineVectorBase<int>, shared by every inline
+// capacity through the base reference, or once per InlineVector<int, N>.
+template<class Vector>
+__attribute__((noinline)) long work(Vector& vec) {
+    for (int i = 0; i < 48; ++i) {
+        vec.push_back(i);
+    }
+    vec.insert(vec.begin() + 3, 7);
+    vec.erase(vec.begin() + 1);
+    long sum = vec.front() + vec.back() + vec[5];
+    while (vec.size() > 2) {
+        vec.pop_back();
+    }
+    for (int x : vec) {
+        sum += x;
+    }
+    vec.clear();
+    return sum;
+}
+
+template<std::size_t N>
+long run_base() {
+    InlineVector<int, N> vec;
+    return work<InlineVectorBase<int>>(vec);
+}
+
+template<std::size_t N>
+long run_template() {
+    InlineVector<int, N> vec;
+    return work(vec);
+}
+
+template<std::size_t... N>
+long all_base(std::size_t rounds, std::index_sequence<N...>) {
+    long sum = 0;
+    for (std::size_t round = 0; round < rounds; ++round) {
+        ((sum += run_base<N>()), ...);
+    }
+    return sum;
+}
+
+template<std::size_t... N>
+long all_template(std::size_t rounds, std::index_sequence<N...>) {
+    long sum = 0;
+    for (std::size_t round = 0; round < rounds; ++round) {
+        ((sum += run_template<N>()), ...);
+    }
+    return sum;
+}
+
+// Ten different inline capacities
+using Capacities = std::index_sequence<1, 2, 3, 4, 6, 8, 12, 16, 24, 32>;
+
+}  // namespace
+
+void bench_base(const BenchConfig& config) {
+    for (std::size_t size : bench_sizes(config)) {
+        std::size_t rounds = size / 100;
+        double ns = measure_ns(config.repeats, [&] { do_not_optimize(all_template(rounds, Capacities())); });
+        print_row("base", "template_per_n", size, Capacities::size(), ns, rounds * Capacities::size());
+
+        ns = measure_ns(config.repeats, [&] { do_not_optimize(all_base(rounds, Capacities())); });
+        print_row("base", "base_reference", size, Capacities::size(), ns, rounds * Capacities::size());
+    }
+}
@@ -0,0 +1,57 @@
+#include "benchmark.hpp"
+#include "inline_vector/concurrent_inline_vector.hpp"
+
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+constexpr std::size_t kInline = 16;
+
+// Run `threads` producers, each appending `per_thread` values through push()
+template<class Push>
+void produce(std::size_t threads, std::size_t per_thread, Push push) {
+    std::vector<std::thread> producers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        producers.emplace_back([&push, per_thread, t] {
+            for (std::size_t i = 0; i < per_thread; ++i) {
+                push(static_cast<int>(t * per_thread + i));
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+}
+
+}  // namespace
+
+void bench_concurrent(const BenchConfig& config) {
+    for (std::size_t size : bench_sizes(config)) {
+        for (std::size_t threads : thread_counts()) {
+            std::size_t per_thread = size / threads;
+
+            std::unique_ptr<ConcurrentInlineVector<int, kInline>> lock_free;
+            double ns = measure_ns(config.repeats,
+                [&] { lock_free = std::make_unique<ConcurrentInlineVector<int, kInline>>(); },
+                [&] { produce(threads, per_thread, [&](int value) { lock_free->push_back(value); }); });
+            print_row("concurrent", "fetch_add_push_back", size, threads, ns, per_thread * threads);
+
+            std::unique_ptr<InlineVector<int, kInline>> locked;
+            std::mutex mutex;
+            ns = measure_ns(config.repeats,
+                [&] { locked = std::make_unique<InlineVector<int, kInline>>(); },
+                [&] {
+                    produce(threads, per_thread, [&](int value) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        locked->push_back(value);
+                    });
+                });
+            print_row("concurrent", "mutex_push_back", size, threads, ns, per_thread * threads);
+
+            ns = measure_ns(config.repeats, [&] { do_not_optimize(lock_free->freeze().size()); });
+            print_row("concurrent", "freeze", size, threads, ns, per_thread * threads);
+        }
+    }
+}
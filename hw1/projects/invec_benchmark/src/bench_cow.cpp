@@ -0,0 +1,57 @@
+#include "benchmark.hpp"
+#include "inline_vector/inline_vector.hpp"
+
+#include <utility>
+
+namespace {
+
+constexpr std::size_t kInline = 16;
+constexpr int kStages = 10;
+constexpr int kFanOut = 4;
+
+// Read-only consumer
+template<class Vector>
+long consume(Vector vec) {
+    const Vector& view = vec;
+    return static_cast<long>(view.size()) + view[view.size() / 2];
+}
+
+// Each stage takes the vector by value, hands copies to kFanOut consumers
+// and passes it on. The last stage optionally writes one element.
+template<class Vector>
+long pipeline(Vector vec, int stage, bool mutate_last) {
+    long result = 0;
+    for (int i = 0; i < kFanOut; ++i) {
+        result += consume(vec);
+    }
+    if (stage + 1 == kStages) {
+        if (mutate_last) {
+            vec[0] = 1;
+        }
+        return result + std::as_const(vec)[0];
+    }
+    return result + pipeline(vec, stage + 1, mutate_last);
+}
+
+template<class Vector>
+void run(const BenchConfig& config, const char* policy, std::size_t size) {
+    Vector source;
+    for (std::size_t i = 0; i < size; ++i) {
+        source.push_back(static_cast<int>(i));
+    }
+    std::string name;
+    for (bool mutate_last : {false, true}) {
+        double ns = measure_ns(config.repeats, [&] { do_not_optimize(pipeline(source, 0, mutate_last)); });
+        name = std::string(policy) + (mutate_last ? "_pipeline_mutate_last" : "_pipeline_read_only");
+        print_row("cow", name.c_str(), size, kStages * kFanOut, ns, kStages * (kFanOut + 1));
+    }
+}
+
+}  // namespace
+
+void bench_cow(const BenchConfig& config) {
+    for (std::size_t size : bench_sizes(config)) {
+        run<InlineVector<int, kInline>>(config, "deep_copy", size);
+        run<InlineVector<int, kInline, std::allocator<int>, CopyOnWrite>>(config, "copy_on_write", size);
+    }
+}
@@ -0,0 +1,68 @@
+#include "benchmark.hpp"
+#include "inline_vector/inline_deque.hpp"
+#include "inline_vector/inline_vector.hpp"
+
+#include <deque>
+#include <string>
+
+namespace {
+
+constexpr std::size_t kInline = 16;
+
+// Queue depths below, at and above the inline capacity
+constexpr std::size_t kDepths[] = {4, kInline, 128};
+
+// InlineVector used as a FIFO the way callers do it today
+struct VectorQueue {
+    InlineVector<int, kInline> vec;
+
+    void push(int value) { vec.push_back(value); }
+    int pop() {
+        int value = vec.front();
+        vec.erase(vec.begin());
+        return value;
+    }
+};
+
+template<class Deque>
+struct DequeQueue {
+    Deque deque;
+
+    void push(int value) { deque.push_back(value); }
+    int pop() {
+        int value = deque.front();
+        deque.pop_front();
+        return value;
+    }
+};
+
+// Keep `depth` elements queued while pushing and popping `ops` times
+template<class Queue>
+void run(const BenchConfig& config, const char* layout, std::size_t ops, std::size_t depth) {
+    std::string name = std::string(layout) + "_fifo";
+    double ns = measure_ns(config.repeats, [&] {
+        Queue queue;
+        for (std::size_t i = 0; i < depth; ++i) {
+            queue.push(static_cast<int>(i));
+        }
+        long sum = 0;
+        for (std::size_t i = 0; i < ops; ++i) {
+            queue.push(static_cast<int>(i));
+            sum += queue.pop();
+        }
+        do_not_optimize(sum);
+    });
+    print_row("deque", name.c_str(), ops, depth, ns, ops);
+}
+
+}  // namespace
+
+void bench_deque(const BenchConfig& config) {
+    for (std::size_t size : bench_sizes(config)) {
+        for (std::size_t depth : kDepths) {
+            run<VectorQueue>(config, "inline_vector", size, depth);
+            run<DequeQueue<InlineDeque<int, kInline>>>(config, "inline_deque", size, depth);
+            run<DequeQueue<std::deque<int>>>(config, "std_deque", size, depth);
+        }
+    }
+}
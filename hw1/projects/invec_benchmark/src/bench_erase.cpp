@@ -0,0 +1,57 @@
+#include "benchmark.hpp"
+#include "inline_vector/inline_vector.hpp"
+
+#include <random>
+
+namespace {
+
+constexpr std::size_t kInline = 16;
+
+// The erase loop is quadratic, larger sizes would take minutes
+constexpr std::size_t kEraseLoopLimit = 100000;
+
+using Vector = InlineVector<int, kInline>;
+
+bool is_odd(int x) {
+    return x & 1;
+}
+
+// Random values, so about half of the elements are removed
+void fill(Vector& vec, std::size_t size) {
+    std::mt19937 rng(42);
+    vec.clear();
+    for (std::size_t i = 0; i < size; ++i) {
+        vec.push_back(static_cast<int>(rng()));
+    }
+}
+
+}  // namespace
+
+void bench_erase(const BenchConfig& config) {
+    for (std::size_t size : bench_sizes(config)) {
+        Vector vec;
+
+        if (size <= kEraseLoopLimit) {
+            double ns = measure_ns(config.repeats, [&] { fill(vec, size); }, [&] {
+                for (auto it = vec.begin(); it != vec.end();) {
+                    it = is_odd(*it) ? vec.erase(it) : it + 1;
+                }
+                do_not_optimize(vec.size());
+            });
+            print_row("erase", "erase_loop", size, kInline, ns, size);
+        }
+
+        double ns = measure_ns(config.repeats, [&] { fill(vec, size); }, [&] {
+            for (auto it = vec.begin(); it != vec.end();) {
+                it = is_odd(*it) ? vec.unordered_erase(it) : it + 1;
+            }
+            do_not_optimize(vec.size());
+        });
+        print_row("erase", "unordered_erase_loop", size, kInline, ns, size);
+
+        ns = measure_ns(config.repeats, [&] { fill(vec, size); }, [&] {
+            do_not_optimize(erase_if(vec, is_odd));
+        });
+        print_row("erase", "erase_if", size, kInline, ns, size);
+    }
+}
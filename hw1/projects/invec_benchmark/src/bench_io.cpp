@@ -0,0 +1,87 @@
+#include "benchmark.hpp"
+#include "inline_vector/io.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+
+namespace {
+
+constexpr std::size_t kInline = 256;
+constexpr std::size_t kChunk = 64 * 1024;
+
+// The file holds this many bytes per benchmark size unit, so the defaults cover 1.6 MB to 160 MB
+constexpr std::size_t kBytesPerUnit = 16;
+
+// Temporary file of `bytes` bytes, unlinked right away so it disappears with the descriptor
+int make_file(std::size_t bytes) {
+    char path[] = "/tmp/inline_vector_bench_XXXXXX";
+    int fd = ::mkstemp(path);
+    if (fd < 0) {
+        std::perror("mkstemp");
+        std::exit(1);
+    }
+    ::unlink(path);
+    std::vector<char> chunk(kChunk);
+    for (std::size_t i = 0; i < chunk.size(); ++i) {
+        chunk[i] = static_cast<char>(i * 31);
+    }
+    for (std::size_t written = 0; written < bytes; written += kChunk) {
+        if (::write(fd, chunk.data(), std::min(kChunk, bytes - written)) < 0) {
+            std::perror("write");
+            std::exit(1);
+        }
+    }
+    return fd;
+}
+
+}  // namespace
+
+void bench_io(const BenchConfig& config) {
+    for (std::size_t size : bench_sizes(config)) {
+        std::size_t bytes = size * kBytesPerUnit;
+        int fd = make_file(bytes);
+
+        // What callers do today: read into a scratch buffer, grow the vector and copy
+        std::vector<char> buffer(kChunk);
+        std::vector<char> std_vec;
+        double ns = measure_ns(config.repeats, [&] { std_vec = std::vector<char>(); }, [&] {
+            off_t offset = 0;
+            ssize_t n;
+            while ((n = ::pread(fd, buffer.data(), kChunk, offset)) > 0) {
+                std_vec.resize(std_vec.size() + n);
+                std::memcpy(std_vec.data() + std_vec.size() - n, buffer.data(), n);
+                offset += n;
+            }
+            do_not_optimize(std_vec.size());
+        });
+        print_row("io", "std_vector_memcpy", bytes, kChunk, ns, bytes);
+
+        InlineVector<char, kInline> vec;
+        ns = measure_ns(config.repeats, [&] { vec.clear(); }, [&] {
+            off_t offset = 0;
+            ssize_t n;
+            while ((n = ::pread(fd, buffer.data(), kChunk, offset)) > 0) {
+                vec.resize(vec.size() + n);
+                std::memcpy(vec.begin() + vec.size() - n, buffer.data(), n);
+                offset += n;
+            }
+            do_not_optimize(vec.size());
+        });
+        print_row("io", "inline_vector_memcpy", bytes, kChunk, ns, bytes);
+
+        ns = measure_ns(config.repeats, [&] { vec.clear(); }, [&] {
+            off_t offset = 0;
+            ssize_t n;
+            while ((n = pread_append(fd, vec, kChunk, offset)) > 0) {
+                offset += n;
+            }
+            do_not_optimize(vec.size());
+        });
+        print_row("io", "inline_vector_pread_append", bytes, kChunk, ns, bytes);
+
+        ::close(fd);
+    }
+}
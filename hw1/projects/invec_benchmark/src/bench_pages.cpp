@@ -0,0 +1,57 @@
+#include "benchmark.hpp"
+#include "inline_vector/huge_page_allocator.hpp"
+#include "inline_vector/inline_vector.hpp"
+
+#include <numeric>
+#include <random>
+#include <string>
+
+namespace {
+
+constexpr std::size_t kInline = 16;
+
+// Build by push_back, then reduce sequentially and through a random permutation
+template<class Vector>
+void run(const BenchConfig& config, const char* layout, std::size_t size, std::size_t alignment) {
+    std::string name;
+    Vector vec;
+
+    double ns = measure_ns(config.repeats, [&] { vec.clear(); }, [&] {
+        for (std::size_t i = 0; i < size; ++i) {
+            vec.push_back(static_cast<double>(i));
+        }
+    });
+    print_row("pages", (name = std::string(layout) + "_push_back").c_str(), size, alignment, ns, size);
+
+    const double* data = vec.begin();
+    ns = measure_ns(config.repeats, [&] {
+        double sum = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            sum += data[i];
+        }
+        do_not_optimize(sum);
+    });
+    print_row("pages", (name = std::string(layout) + "_sum").c_str(), size, alignment, ns, size);
+
+    std::vector<std::uint32_t> order(size);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+    ns = measure_ns(config.repeats, [&] {
+        double sum = 0;
+        for (std::uint32_t index : order) {
+            sum += data[index];
+        }
+        do_not_optimize(sum);
+    });
+    print_row("pages", (name = std::string(layout) + "_gather_sum").c_str(), size, alignment, ns, size);
+}
+
+}  // namespace
+
+void bench_pages(const BenchConfig& config) {
+    for (std::size_t size : bench_sizes(config)) {
+        run<InlineVector<double, kInline>>(config, "default", size, alignof(double));
+        run<InlineVector<double, kInline, std::allocator<double>, DeepCopy, 64>>(config, "aligned", size, 64);
+        run<InlineVector<double, kInline, HugePageAllocator<double>>>(config, "huge_pages", size, kHugePageSize);
+    }
+}
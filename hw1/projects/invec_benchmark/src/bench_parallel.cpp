@@ -0,0 +1,43 @@
+#include "benchmark.hpp"
+#include "inline_vector/parallel.hpp"
+
+#include <random>
+
+namespace {
+
+using Vector = InlineVector<int, 16>;
+
+}  // namespace
+
+void bench_parallel(const BenchConfig& config) {
+    for (std::size_t size : bench_sizes(config)) {
+        Vector source;
+        std::mt19937 rng(42);
+        for (std::size_t i = 0; i < size; ++i) {
+            source.push_back(static_cast<int>(rng() % 1000));
+        }
+
+        for (std::size_t threads : thread_counts()) {
+            Vector vec(source);
+            double ns = measure_ns(config.repeats, [&] {
+                parallel_fill(vec, 7, 0, threads);
+            });
+            print_row("parallel", "fill", size, threads, ns, size);
+
+            ns = measure_ns(config.repeats, [&] {
+                parallel_transform(vec, [](int x) { return x * 3 + 1; }, 0, threads);
+            });
+            print_row("parallel", "transform", size, threads, ns, size);
+
+            ns = measure_ns(config.repeats, [&] {
+                do_not_optimize(parallel_reduce(source, 0L, std::plus<>(), 0, threads));
+            });
+            print_row("parallel", "reduce", size, threads, ns, size);
+
+            ns = measure_ns(config.repeats, [&] { vec = source; }, [&] {
+                parallel_sort(vec, std::less<int>(), 0, threads);
+            });
+            print_row("parallel", "sort", size, threads, ns, size);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#include "benchmark.hpp"
+#include "inline_vector/segmented_inline_vector.hpp"
+
+#include <numeric>
+#include <random>
+
+namespace {
+
+constexpr std::size_t kInline = 16;
+
+// Same scenarios for the contiguous and the segmented layout
+template<class Vector>
+void run(const BenchConfig& config, const char* layout, std::size_t size) {
+    std::string name;
+    Vector vec;
+
+    double ns = measure_ns(config.repeats, [&] { vec.clear(); }, [&] {
+        for (std::size_t i = 0; i < size; ++i) {
+            vec.push_back(static_cast<int>(i));
+        }
+    });
+    print_row("segmented", (name = std::string(layout) + "_push_back").c_str(), size, kInline, ns, size);
+
+    ns = measure_ns(config.repeats, [&] {
+        long sum = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            sum += vec[i];
+        }
+        do_not_optimize(sum);
+    });
+    print_row("segmented", (name = std::string(layout) + "_index_scan").c_str(), size, kInline, ns, size);
+
+    std::vector<std::size_t> order(size);
+    std::mt19937 rng(42);
+    for (auto& index : order) {
+        index = rng() % size;
+    }
+    ns = measure_ns(config.repeats, [&] {
+        long sum = 0;
+        for (std::size_t index : order) {
+            sum += vec[index];
+        }
+        do_not_optimize(sum);
+    });
+    print_row("segmented", (name = std::string(layout) + "_random_access").c_str(), size, kInline, ns, size);
+
+    ns = measure_ns(config.repeats, [&] {
+        do_not_optimize(std::accumulate(vec.begin(), vec.end(), 0L));
+    });
+    print_row("segmented", (name = std::string(layout) + "_iterate").c_str(), size, kInline, ns, size);
+}
+
+}  // namespace
+
+void bench_segmented(const BenchConfig& config) {
+    for (std::size_t size : bench_sizes(config)) {
+        run<InlineVector<int, kInline>>(config, "contiguous", size);
+        run<SegmentedInlineVector<int, kInline>>(config, "segmented", size);
+
+        SegmentedInlineVector<int, kInline> vec;
+        for (std::size_t i = 0; i < size; ++i) {
+            vec.push_back(static_cast<int>(i));
+        }
+        double ns = measure_ns(config.repeats, [&] { do_not_optimize(vec.flatten().size()); });
+        print_row("segmented", "flatten", size, kInline, ns, size);
+    }
+}
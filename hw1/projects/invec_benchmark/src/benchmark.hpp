@@ -0,0 +1,123 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Common benchmark settings, filled from the command line
+struct BenchConfig {
+    std::size_t min_size = 100000;
+    std::size_t max_size = 10000000;
+    int repeats = 5;
+};
+
+// Parse `--name=N` into value, returns false if arg is a different option
+inline bool parse_option(const char* arg, const char* name, std::size_t& value) {
+    std::size_t length = std::strlen(name);
+    if (std::strncmp(arg, name, length) != 0 || arg[length] != '=') {
+        return false;
+    }
+    value = std::strtoull(arg + length + 1, nullptr, 10);
+    return true;
+}
+
+// Parse the options every benchmark executable accepts
+inline bool parse_config_option(const char* arg, BenchConfig& config) {
+    std::size_t repeats = 0;
+    if (parse_option(arg, "--min-size", config.min_size) || parse_option(arg, "--max-size", config.max_size)) {
+        return true;
+    }
+    if (parse_option(arg, "--repeats", repeats)) {
+        config.repeats = static_cast<int>(repeats);
+        return true;
+    }
+    return false;
+}
+
+// Usage line with the executable's own `options`, then the names it accepts as arguments
+template<class Entry, std::size_t Count>
+void print_usage(const char* program, const char* options, const char* argument, const char* title,
+                 const Entry (&entries)[Count]) {
+    std::fprintf(stderr, "Usage: %s [--min-size=N] [--max-size=N] [--repeats=N]%s [%s...]\n", program, options, argument);
+    std::fprintf(stderr, "%s:", title);
+    for (const auto& entry : entries) {
+        std::fprintf(stderr, " %s", entry.name);
+    }
+    std::fprintf(stderr, "\n");
+}
+
+// 1, 2, 4, ... up to and including the number of hardware threads
+inline std::vector<std::size_t> thread_counts() {
+    std::size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::size_t> counts;
+    for (std::size_t threads = 1; threads < cores; threads *= 2) {
+        counts.push_back(threads);
+    }
+    counts.push_back(cores);
+    return counts;
+}
+
+// Sizes from min_size to max_size, growing tenfold
+inline std::vector<std::size_t> bench_sizes(const BenchConfig& config) {
+    std::vector<std::size_t> sizes;
+    for (std::size_t size = config.min_size; size <= config.max_size; size *= 10) {
+        sizes.push_back(size);
+    }
+    return sizes;
+}
+
+// Keep the optimizer from discarding a computed value
+template<class T>
+inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Best wall time of `repeats` runs in nanoseconds, setup() is not timed
+template<class Setup, class Fn>
+double measure_ns(int repeats, Setup setup, Fn fn) {
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < repeats; ++i) {
+        setup();
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count());
+    }
+    return best;
+}
+
+template<class Fn>
+double measure_ns(int repeats, Fn fn) {
+    return measure_ns(repeats, [] {}, fn);
+}
+
+inline void print_header() {
+    std::printf("suite,scenario,size,param,total_ns,ns_per_op\n");
+}
+
+// One CSV row, `ops` is the number of elements or operations timed
+inline void print_row(const char* suite, const char* scenario, std::size_t size,
+                      std::size_t param, double total_ns, std::size_t ops) {
+    std::printf("%s,%s,%zu,%zu,%.0f,%.3f\n", suite, scenario, size, param, total_ns,
+                total_ns / static_cast<double>(std::max<std::size_t>(ops, 1)));
+    std::fflush(stdout);
+}
+
+// Benchmark suites
+void bench_parallel(const BenchConfig& config);
+void bench_concurrent(const BenchConfig& config);
+void bench_segmented(const BenchConfig& config);
+void bench_algorithm(const BenchConfig& config);
+void bench_cow(const BenchConfig& config);
+void bench_base(const BenchConfig& config);
+void bench_array(const BenchConfig& config);
+void bench_deque(const BenchConfig& config);
+void bench_erase(const BenchConfig& config);
+void bench_io(const BenchConfig& config);
+void bench_pages(const BenchConfig& config);
@@ -0,0 +1,54 @@
+#include "benchmark.hpp"
+
+#include <string>
+
+namespace {
+
+struct Suite {
+    const char* name;
+    void (*run)(const BenchConfig&);
+};
+
+const Suite kSuites[] = {
+    {"parallel", bench_parallel},
+    {"concurrent", bench_concurrent},
+    {"segmented", bench_segmented},
+    {"algorithm", bench_algorithm},
+    {"cow", bench_cow},
+    {"base", bench_base},
+    {"array", bench_array},
+    {"deque", bench_deque},
+    {"erase", bench_erase},
+    {"io", bench_io},
+    {"pages", bench_pages},
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    std::vector<std::string> selected;
+
+    for (int i = 1; i < argc; ++i) {
+        if (parse_config_option(argv[i], config)) {
+            continue;
+        }
+        if (argv[i][0] == '-') {
+            print_usage(argv[0], "", "suite", "Suites", kSuites);
+            return 1;
+        }
+        selected.emplace_back(argv[i]);
+    }
+    if (config.min_size == 0 || config.repeats <= 0) {
+        print_usage(argv[0], "", "suite", "Suites", kSuites);
+        return 1;
+    }
+
+    print_header();
+    for (const auto& suite : kSuites) {
+        if (selected.empty() || std::find(selected.begin(), selected.end(), suite.name) != selected.end()) {
+            suite.run(config);
+        }
+    }
+    return 0;
+}
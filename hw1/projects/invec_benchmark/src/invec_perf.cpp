@@ -0,0 +1,226 @@
+#include "benchmark.hpp"
+#include "perf_counters.hpp"
+#include "inline_vector/inline_vector.hpp"
+
+#include <cstring>
+#include <random>
+#include <string>
+
+// Hardware-counter harness: every scenario runs `repeats` times between perf_event_open
+// counters, and the fastest run is reported per operation as CSV or JSON.
+
+namespace {
+
+constexpr std::size_t kInline = 16;
+
+// push_back scenario fills each vector to twice the inline capacity, crossing the spill
+constexpr std::size_t kSpillLength = 2 * kInline;
+
+// Middle insert/erase works on a vector of this size, each op moves about half of it twice
+constexpr std::size_t kMiddleSize = 1024;
+constexpr std::size_t kMiddleOpsDivisor = 16;
+
+using Vector = InlineVector<int, kInline>;
+
+class Harness {
+
+public:
+    Harness(const BenchConfig& config, bool json) : config_(config), json_(json), rows_(0) {}
+
+    void begin() {
+        if (json_) {
+            std::printf("[");
+        } else {
+            std::printf("scenario,size,ops,ns_per_op");
+            for (const auto& spec : kCounterSpecs) {
+                std::printf(",%s", spec.name);
+            }
+            std::printf("\n");
+        }
+    }
+
+    void end() {
+        if (json_) {
+            std::printf("\n]\n");
+        }
+    }
+
+    // Time and count fn() after an untimed setup(), report the fastest of the repeats
+    template<class Setup, class Fn>
+    void measure(const char* scenario, std::size_t size, std::size_t ops, Setup setup, Fn fn) {
+        double best_ns = std::numeric_limits<double>::max();
+        CounterValues best_values{};
+        for (int i = 0; i < config_.repeats; ++i) {
+            setup();
+            counters_.start();
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            auto stop = std::chrono::steady_clock::now();
+            CounterValues values = counters_.stop();
+            double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+            if (ns < best_ns) {
+                best_ns = ns;
+                best_values = values;
+            }
+        }
+        report(scenario, size, ops, best_ns, best_values);
+    }
+
+private:
+    void report(const char* scenario, std::size_t size, std::size_t ops, double ns, const CounterValues& values) {
+        double per_op = 1.0 / static_cast<double>(std::max<std::size_t>(ops, 1));
+        if (json_) {
+            std::printf("%s\n  {\"scenario\": \"%s\", \"size\": %zu, \"ops\": %zu, \"ns_per_op\": %.3f",
+                        rows_ ? "," : "", scenario, size, ops, ns * per_op);
+            for (std::size_t i = 0; i < kCounterCount; ++i) {
+                if (values[i] < 0) {
+                    std::printf(", \"%s\": null", kCounterSpecs[i].name);
+                } else {
+                    std::printf(", \"%s\": %.4f", kCounterSpecs[i].name, values[i] * per_op);
+                }
+            }
+            std::printf("}");
+        } else {
+            std::printf("%s,%zu,%zu,%.3f", scenario, size, ops, ns * per_op);
+            for (double value : values) {
+                if (value < 0) {
+                    std::printf(",NA");
+                } else {
+                    std::printf(",%.4f", value * per_op);
+                }
+            }
+            std::printf("\n");
+        }
+        std::fflush(stdout);
+        ++rows_;
+    }
+
+    const BenchConfig& config_;
+    bool json_;
+    std::size_t rows_;
+    PerfCounters counters_;
+};
+
+void filled(Vector& vec, std::size_t size) {
+    vec.clear();
+    for (std::size_t i = 0; i < size; ++i) {
+        vec.push_back(static_cast<int>(i));
+    }
+}
+
+void scenario_push_back(Harness& harness, std::size_t size) {
+    std::vector<Vector> vectors(size / kSpillLength);
+    harness.measure("push_back_spill", size, vectors.size() * kSpillLength, [&] {
+        for (auto& vec : vectors) {
+            vec.clear();
+        }
+    }, [&] {
+        for (auto& vec : vectors) {
+            for (std::size_t i = 0; i < kSpillLength; ++i) {
+                vec.push_back(static_cast<int>(i));
+            }
+        }
+    });
+}
+
+void scenario_iterate(Harness& harness, std::size_t size) {
+    Vector vec;
+    filled(vec, size);
+    harness.measure("iterate", size, size, [] {}, [&] {
+        long sum = 0;
+        for (int x : vec) {
+            sum += x;
+        }
+        do_not_optimize(sum);
+    });
+}
+
+void scenario_random_access(Harness& harness, std::size_t size) {
+    Vector vec;
+    filled(vec, size);
+    std::vector<std::size_t> order(size);
+    std::mt19937 rng(42);
+    for (auto& index : order) {
+        index = rng() % size;
+    }
+    harness.measure("random_access", size, size, [] {}, [&] {
+        long sum = 0;
+        for (std::size_t index : order) {
+            sum += vec[index];
+        }
+        do_not_optimize(sum);
+    });
+}
+
+void scenario_insert_erase(Harness& harness, std::size_t size) {
+    Vector vec;
+    std::size_t ops = size / kMiddleOpsDivisor;
+    harness.measure("insert_erase_middle", size, ops, [&] { filled(vec, kMiddleSize); }, [&] {
+        for (std::size_t i = 0; i < ops; ++i) {
+            vec.insert(vec.begin() + kMiddleSize / 2, static_cast<int>(i));
+            vec.erase(vec.begin() + kMiddleSize / 2 + 1);
+        }
+        do_not_optimize(vec.size());
+    });
+}
+
+void scenario_copy(Harness& harness, std::size_t size) {
+    Vector vec;
+    filled(vec, size);
+    harness.measure("copy", size, size, [] {}, [&] {
+        Vector copy(vec);
+        do_not_optimize(copy.size());
+    });
+}
+
+struct Scenario {
+    const char* name;
+    void (*run)(Harness&, std::size_t);
+};
+
+const Scenario kScenarios[] = {
+    {"push_back_spill", scenario_push_back},
+    {"iterate", scenario_iterate},
+    {"random_access", scenario_random_access},
+    {"insert_erase_middle", scenario_insert_erase},
+    {"copy", scenario_copy},
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    bool json = false;
+    std::vector<std::string> selected;
+
+    for (int i = 1; i < argc; ++i) {
+        if (parse_config_option(argv[i], config)) {
+            continue;
+        }
+        if (std::strcmp(argv[i], "--json") == 0) {
+            json = true;
+            continue;
+        }
+        if (argv[i][0] == '-') {
+            print_usage(argv[0], " [--json]", "scenario", "Scenarios", kScenarios);
+            return 1;
+        }
+        selected.emplace_back(argv[i]);
+    }
+    if (config.min_size == 0 || config.repeats <= 0) {
+        print_usage(argv[0], " [--json]", "scenario", "Scenarios", kScenarios);
+        return 1;
+    }
+
+    Harness harness(config, json);
+    harness.begin();
+    for (std::size_t size : bench_sizes(config)) {
+        for (const auto& scenario : kScenarios) {
+            if (selected.empty() || std::find(selected.begin(), selected.end(), scenario.name) != selected.end()) {
+                scenario.run(harness, size);
+            }
+        }
+    }
+    harness.end();
+    return 0;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Hardware and software events counted around each scenario
+struct CounterSpec {
+    const char* name;
+    std::uint32_t type;
+    std::uint64_t config;
+};
+
+constexpr std::uint64_t cache_event(std::uint64_t cache, std::uint64_t op, std::uint64_t result) {
+    return cache | (op << 8) | (result << 16);
+}
+
+constexpr std::array<CounterSpec, 6> kCounterSpecs = {{
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"l1d_misses", PERF_TYPE_HW_CACHE,
+     cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"llc_misses", PERF_TYPE_HW_CACHE,
+     cache_event(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"page_faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+}};
+
+constexpr std::size_t kCounterCount = kCounterSpecs.size();
+
+// Counts of one measured run, negative values mean the counter is unavailable
+using CounterValues = std::array<double, kCounterCount>;
+
+// perf_event_open counters for the calling thread, user space only.
+// Each event is opened on its own, so a missing PMU (common in containers and VMs) or
+// an unsupported cache event only disables that counter, never the whole harness.
+// Every counter that reports NA gets one note on stderr, whether it failed to open or
+// opened but was never scheduled on the PMU.
+class PerfCounters {
+
+public:
+    PerfCounters() : noted_{} {
+        for (std::size_t i = 0; i < kCounterCount; ++i) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = kCounterSpecs[i].type;
+            attr.config = kCounterSpecs[i].config;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            fds_[i] = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+            if (fds_[i] < 0) {
+                note(i, std::strerror(errno));
+            }
+        }
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    ~PerfCounters() {
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+    }
+
+    void start() {
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+    }
+
+    // Stop counting and return the counts, scaled up if the kernel multiplexed the counter
+    CounterValues stop() {
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+        CounterValues values;
+        for (std::size_t i = 0; i < kCounterCount; ++i) {
+            values[i] = -1;
+            std::uint64_t data[3];
+            if (fds_[i] < 0) {
+                continue;
+            }
+            if (::read(fds_[i], data, sizeof(data)) != sizeof(data)) {
+                note(i, "read failed");
+            } else if (data[2] == 0) {
+                note(i, "counter opened but never ran");
+            } else {
+                values[i] = static_cast<double>(data[0]) * static_cast<double>(data[1]) / static_cast<double>(data[2]);
+            }
+        }
+        return values;
+    }
+
+private:
+    void note(std::size_t counter, const char* reason) {
+        if (!noted_[counter]) {
+            std::fprintf(stderr, "perf: %s unavailable: %s\n", kCounterSpecs[counter].name, reason);
+            noted_[counter] = true;
+        }
+    }
+
+    std::array<int, kCounterCount> fds_;
+    std::array<bool, kCounterCount> noted_;
+};
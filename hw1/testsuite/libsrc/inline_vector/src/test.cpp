@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "inline_vector/inline_vector.hpp"
 
+#include <string>
+
 template <typename T>
 class TestAllocator {
 public:
@@ -155,6 +157,25 @@ TEST(InlinedVectorTest, OperatorBrackets) {
     }
 }
 
+TEST(InlinedVectorTest, Iterators) {
+    {
+        InlineVector<int, 4> vec = {1, 2, 3};
+
+        ASSERT_EQ(vec.end() - vec.begin(), 3);
+        ASSERT_EQ(*(vec.end() - 1), 3);
+    }
+
+    {
+        InlineVector<int, 4> vec = {1, 2, 3, 4, 5, 6};
+        int sum = 0;
+        for (int x : vec)
+            sum += x;
+
+        ASSERT_EQ(vec.end() - vec.begin(), 6);
+        ASSERT_EQ(sum, 21);
+    }
+}
+
 TEST(InlinedVectorTest, Reserve) {
     {
         InlineVector<int, 4> vec = {};
@@ -472,6 +493,114 @@ TEST(InlinedVectorTest, Erase) {
     }
 }
 
+std::size_t counted_allocations = 0;
+
+template <typename T>
+class CountingAllocator : public std::allocator<T> {
+public:
+    template<typename U>
+    struct rebind {
+        using other = CountingAllocator<U>;
+    };
+
+    T* allocate(std::size_t n) {
+        ++counted_allocations;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+TEST(InlinedVectorTest, UnorderedErase) {
+    {
+        InlineVector<int, 4> vec = {1, 2, 3, 4};
+        InlineVector<int, 4> ideal_vec = {4, 2, 3};
+
+        auto it = vec.unordered_erase(vec.begin());
+
+        ASSERT_EQ(*it, 4);
+        ASSERT_EQ(vec, ideal_vec);
+
+        vec.unordered_erase(vec.begin() + 2);
+        vec.unordered_erase(vec.begin() + 1);
+        vec.unordered_erase(vec.begin());
+
+        ASSERT_TRUE(vec.empty());
+        ASSERT_THROW(vec.unordered_erase(vec.begin()), std::out_of_range);
+    }
+
+    {
+        InlineVector<int, 2> vec = {1, 2, 3};
+        InlineVector<int, 2> ideal_vec = {3, 2};
+
+        vec.unordered_erase(vec.begin());
+
+        ASSERT_EQ(vec.size(), 2);
+        ASSERT_EQ(vec.capacity(), 2);
+        ASSERT_EQ(vec, ideal_vec);
+    }
+}
+
+TEST(InlinedVectorTest, RemoveIf) {
+    {
+        InlineVector<int, 4> vec = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+        ASSERT_EQ(vec.remove_if([](int x) { return x % 2 == 0; }), 5);
+        ASSERT_EQ(vec.size(), 5);
+        ASSERT_EQ(vec.capacity(), 16);
+        for (int i = 0; i < 5; ++i)
+            ASSERT_EQ(vec[i], 2 * i + 1);
+
+        ASSERT_EQ(erase_if(vec, [](int x) { return x > 3; }), 3);
+        ASSERT_EQ(vec.size(), 2);
+        ASSERT_EQ(vec.capacity(), 4);
+        ASSERT_EQ(vec[0], 1);
+        ASSERT_EQ(vec[1], 3);
+
+        ASSERT_EQ(erase_if(vec, [](int) { return false; }), 0);
+        ASSERT_EQ(erase_if(vec, [](int) { return true; }), 2);
+        ASSERT_TRUE(vec.empty());
+    }
+
+    {
+        InlineVector<std::string, 2> vec = {"a", "bb", "c", "dd", "e"};
+
+        erase_if(vec, [](const std::string& s) { return s.size() == 1; });
+
+        ASSERT_EQ(vec.size(), 2);
+        ASSERT_EQ(vec[0], "bb");
+        ASSERT_EQ(vec[1], "dd");
+    }
+
+    {
+        // Survivors are moved back inline, not copied
+        std::string long_string(64, 'x');
+        InlineVector<std::string, 2> vec = {"a", long_string, "c"};
+        const char* data = vec[1].data();
+
+        erase_if(vec, [](const std::string& s) { return s.size() == 1; });
+
+        ASSERT_EQ(vec.size(), 1);
+        ASSERT_EQ(vec.capacity(), 2);
+        ASSERT_EQ(vec[0], long_string);
+        ASSERT_EQ(vec[0].data(), data);
+    }
+
+    {
+        // Shrinking never allocates
+        InlineVector<int, 4, CountingAllocator<int>> vec = {1, 2, 3, 4, 5, 6};
+        std::size_t allocations = counted_allocations;
+
+        vec.erase(vec.begin());
+        vec.pop_back();
+        vec.pop_back();
+        vec.unordered_erase(vec.begin());
+        erase_if(vec, [](int x) { return x == 3; });
+
+        ASSERT_EQ(counted_allocations, allocations);
+        ASSERT_EQ(vec.size(), 1);
+        ASSERT_EQ(vec[0], 4);
+    }
+}
+
 TEST(InlinedVectorTest, CustomAllocator) {
     {
         InlineVector<int, 4, TestAllocator<int>> vec;
@@ -557,6 +686,58 @@ TEST(InlinedVectorTest, Types) {
     }
 }
 
+long sum_through_base(InlineVectorBase<int>& vec) {
+    vec.push_back(100);
+    long sum = 0;
+    for (int x : vec)
+        sum += x;
+    return sum;
+}
+
+TEST(InlinedVectorTest, Base) {
+    {
+        InlineVector<int, 2> small_vec = {1, 2};
+        InlineVector<int, 8> large_vec = {1, 2};
+
+        ASSERT_EQ(sum_through_base(small_vec), 103);
+        ASSERT_EQ(sum_through_base(large_vec), 103);
+        ASSERT_EQ(small_vec.capacity(), 4);
+        ASSERT_EQ(large_vec.capacity(), 8);
+        ASSERT_EQ(small_vec.inline_capacity(), 2);
+        ASSERT_EQ(large_vec.inline_capacity(), 8);
+    }
+
+    {
+        InlineVector<int, 2> small_vec = {1, 2, 3, 4, 5};
+        InlineVector<int, 8> large_vec(small_vec);
+
+        ASSERT_EQ(large_vec.size(), 5);
+        ASSERT_EQ(large_vec.capacity(), 8);
+        ASSERT_EQ(large_vec[4], 5);
+
+        small_vec = InlineVector<int, 8>{7};
+
+        ASSERT_EQ(small_vec.size(), 1);
+        ASSERT_EQ(small_vec.capacity(), 2);
+        ASSERT_EQ(small_vec[0], 7);
+    }
+
+    {
+        // The inline buffer is found from the object address and ends the object
+        InlineVector<int, 4> vec = {1, 2};
+        const char* object = reinterpret_cast<const char*>(&vec);
+        const char* buffer = reinterpret_cast<const char*>(vec.begin());
+
+        ASSERT_EQ(buffer + 4 * sizeof(int), object + sizeof(vec));
+
+        InlineVector<int, 4> copy(vec);
+
+        ASSERT_EQ(reinterpret_cast<const char*>(copy.begin()) - reinterpret_cast<const char*>(&copy),
+                  buffer - object);
+        ASSERT_EQ(copy, vec);
+    }
+}
+
 int main(int argc, char** argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+#include "inline_vector/algorithm.hpp"
+
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+template<class Vector>
+std::vector<typename Vector::value_type> to_std(const Vector& vec) {
+    return std::vector<typename Vector::value_type>(vec.begin(), vec.end());
+}
+
+TEST(InlinedVectorAlgorithmTest, Resize) {
+    InlineVector<int, 4> vec = {1, 2};
+
+    vec.resize(4);
+
+    ASSERT_EQ(vec, (InlineVector<int, 4>{1, 2, 0, 0}));
+
+    vec.resize(6);
+
+    ASSERT_EQ(vec.capacity(), 8);
+    ASSERT_EQ(vec, (InlineVector<int, 4>{1, 2, 0, 0, 0, 0}));
+
+    vec[5] = 6;
+    vec.resize(3);
+
+    ASSERT_EQ(vec.capacity(), 4);
+    ASSERT_EQ(vec, (InlineVector<int, 4>{1, 2, 0}));
+
+    vec.resize(0);
+
+    ASSERT_TRUE(vec.empty());
+}
+
+TEST(InlinedVectorAlgorithmTest, Sort) {
+    std::mt19937 rng(1);
+    for (std::size_t size = 0; size <= 40; ++size) {
+        InlineVector<std::uint32_t, 16> vec;
+        InlineVector<double, 32> real_vec;
+        InlineVector<std::string, 4> string_vec;
+        for (std::size_t i = 0; i < size; ++i) {
+            vec.push_back(rng() % 50);
+            real_vec.push_back(static_cast<double>(rng() % 1000) / 7 - 50);
+            string_vec.push_back(std::to_string(rng() % 100));
+        }
+        auto expected = to_std(vec);
+        auto real_expected = to_std(real_vec);
+        auto string_expected = to_std(string_vec);
+        std::sort(expected.begin(), expected.end());
+        std::sort(real_expected.begin(), real_expected.end());
+        std::sort(string_expected.begin(), string_expected.end());
+
+        sort(vec);
+        sort(real_vec);
+        sort(string_vec);
+
+        ASSERT_EQ(to_std(vec), expected);
+        ASSERT_EQ(to_std(real_vec), real_expected);
+        ASSERT_EQ(to_std(string_vec), string_expected);
+    }
+
+    {
+        // Real values equal to the padding of the network
+        InlineVector<std::uint32_t, 8> vec = {UINT32_MAX, 3, UINT32_MAX, 0, 7};
+
+        sort(vec);
+
+        ASSERT_EQ(vec, (InlineVector<std::uint32_t, 8>{0, 3, 7, UINT32_MAX, UINT32_MAX}));
+    }
+
+    {
+        // Above kSortNetworkLimit inline vectors use std::sort
+        InlineVector<int, 64> vec;
+        for (int i = 0; i < 64; ++i)
+            vec.push_back((i * 37) % 64);
+
+        sort(vec);
+
+        for (int i = 0; i < 64; ++i)
+            ASSERT_EQ(vec[i], i);
+    }
+}
+
+TEST(InlinedVectorAlgorithmTest, Unique) {
+    {
+        InlineVector<int, 8> vec = {1, 1, 2, 3, 3, 3, 4};
+
+        ASSERT_EQ(unique(vec), 4);
+        ASSERT_EQ(vec, (InlineVector<int, 8>{1, 2, 3, 4}));
+    }
+
+    {
+        InlineVector<int, 4> vec = {1, 1, 2, 2, 3, 3, 4, 4};
+
+        ASSERT_EQ(unique(vec), 4);
+        ASSERT_EQ(vec.capacity(), 4);
+        ASSERT_EQ(vec, (InlineVector<int, 4>{1, 2, 3, 4}));
+    }
+
+    {
+        InlineVector<int, 4> vec = {};
+
+        ASSERT_EQ(unique(vec), 0);
+    }
+}
+
+TEST(InlinedVectorAlgorithmTest, SetOperations) {
+    {
+        InlineVector<std::uint32_t, 8> lhs = {1, 3, 5, 7};
+        InlineVector<std::uint32_t, 8> rhs = {2, 3, 4, 7, 9};
+
+        ASSERT_EQ(set_union(lhs, rhs), (InlineVector<std::uint32_t, 8>{1, 2, 3, 4, 5, 7, 9}));
+        ASSERT_EQ(set_intersection(lhs, rhs), (InlineVector<std::uint32_t, 8>{3, 7}));
+    }
+
+    std::mt19937 rng(2);
+    for (int round = 0; round < 200; ++round) {
+        std::set<int> lhs_set, rhs_set;
+        std::size_t lhs_size = rng() % 40, rhs_size = rng() % 40;
+        while (lhs_set.size() < lhs_size)
+            lhs_set.insert(static_cast<int>(rng() % 64) - 32);
+        while (rhs_set.size() < rhs_size)
+            rhs_set.insert(static_cast<int>(rng() % 64) - 32);
+        InlineVector<int, 16> lhs, rhs;
+        for (int x : lhs_set)
+            lhs.push_back(x);
+        for (int x : rhs_set)
+            rhs.push_back(x);
+        std::vector<int> expected_union, expected_intersection;
+        std::set_union(lhs_set.begin(), lhs_set.end(), rhs_set.begin(), rhs_set.end(),
+                       std::back_inserter(expected_union));
+        std::set_intersection(lhs_set.begin(), lhs_set.end(), rhs_set.begin(), rhs_set.end(),
+                              std::back_inserter(expected_intersection));
+
+        ASSERT_EQ(to_std(set_union(lhs, rhs)), expected_union);
+        ASSERT_EQ(to_std(set_intersection(lhs, rhs)), expected_intersection);
+    }
+
+    {
+        InlineVector<std::string, 2> lhs = {"a", "b", "c"};
+        InlineVector<std::string, 2> rhs = {"b", "d"};
+
+        ASSERT_EQ(to_std(set_union(lhs, rhs)), (std::vector<std::string>{"a", "b", "c", "d"}));
+        ASSERT_EQ(to_std(set_intersection(lhs, rhs)), (std::vector<std::string>{"b"}));
+    }
+}
+
+TEST(InlinedVectorAlgorithmTest, SetOperationsRepeats) {
+    {
+        InlineVector<int, 4> lhs;
+        for (int i = 0; i < 16; ++i)
+            lhs.push_back(1);
+        InlineVector<int, 4> rhs = {1, 2, 3, 4};
+
+        ASSERT_EQ(to_std(set_intersection(lhs, rhs)), (std::vector<int>{1}));
+        ASSERT_EQ(to_std(set_intersection(rhs, lhs)), (std::vector<int>{1}));
+        ASSERT_EQ(set_union(lhs, rhs).size(), 19);
+    }
+
+    {
+        // The run of 5 starts in the last full block and ends in the tail
+        InlineVector<int, 4> lhs = {1, 2, 3, 5, 5};
+        InlineVector<int, 4> rhs = {5, 6, 7, 8};
+
+        ASSERT_EQ(to_std(set_intersection(lhs, rhs)), (std::vector<int>{5}));
+    }
+
+    std::mt19937 rng(3);
+    for (int round = 0; round < 500; ++round) {
+        std::vector<int> lhs_std(rng() % 40), rhs_std(rng() % 40);
+        unsigned range = 2 + round % 64;
+        for (int& x : lhs_std)
+            x = static_cast<int>(rng() % range);
+        for (int& x : rhs_std)
+            x = static_cast<int>(rng() % range);
+        std::sort(lhs_std.begin(), lhs_std.end());
+        std::sort(rhs_std.begin(), rhs_std.end());
+        InlineVector<int, 8> lhs, rhs;
+        for (int x : lhs_std)
+            lhs.push_back(x);
+        for (int x : rhs_std)
+            rhs.push_back(x);
+        std::vector<int> expected_union, expected_intersection;
+        std::set_union(lhs_std.begin(), lhs_std.end(), rhs_std.begin(), rhs_std.end(),
+                       std::back_inserter(expected_union));
+        std::set_intersection(lhs_std.begin(), lhs_std.end(), rhs_std.begin(), rhs_std.end(),
+                              std::back_inserter(expected_intersection));
+
+        ASSERT_EQ(to_std(set_union(lhs, rhs)), expected_union);
+        ASSERT_EQ(to_std(set_intersection(lhs, rhs)), expected_intersection);
+    }
+}
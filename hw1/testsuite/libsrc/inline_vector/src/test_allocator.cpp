@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "inline_vector/huge_page_allocator.hpp"
+#include "inline_vector/inline_vector.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace {
+
+bool aligned_to(const void* p, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(InlinedVectorAllocatorTest, Alignment) {
+    {
+        InlineVector<float, 5, std::allocator<float>, DeepCopy, 64> vec;
+
+        for (int i = 0; i < 5; ++i)
+            vec.push_back(static_cast<float>(i));
+
+        ASSERT_TRUE(aligned_to(vec.begin(), 64));
+
+        for (int i = 5; i < 1000; ++i) {
+            vec.push_back(static_cast<float>(i));
+            ASSERT_TRUE(aligned_to(vec.begin(), 64));
+        }
+        for (int i = 0; i < 1000; ++i)
+            ASSERT_EQ(vec[i], static_cast<float>(i));
+
+        vec.resize(3);
+
+        ASSERT_TRUE(aligned_to(vec.begin(), 64));
+        ASSERT_EQ(vec.back(), 2.0f);
+    }
+
+    {
+        InlineVector<std::string, 2, std::allocator<std::string>, CopyOnWrite, 32> vec = {"a", "b", "c"};
+        InlineVector<std::string, 2, std::allocator<std::string>, CopyOnWrite, 32> copy = vec;
+
+        ASSERT_TRUE(aligned_to(std::as_const(vec).begin(), 32));
+        ASSERT_EQ(std::as_const(copy).begin(), std::as_const(vec).begin());
+
+        copy.push_back("d");
+
+        ASSERT_TRUE(aligned_to(copy.begin(), 32));
+        ASSERT_EQ(vec.size(), 3);
+        ASSERT_EQ(copy.back(), "d");
+    }
+}
+
+TEST(InlinedVectorAllocatorTest, HugePages) {
+    {
+        InlineVector<int, 4, HugePageAllocator<int, 4096>> vec;
+
+        for (int i = 0; i < 100000; ++i)
+            vec.push_back(i);
+
+        ASSERT_EQ(vec.size(), 100000);
+        ASSERT_EQ(vec.capacity(), 131072);
+        for (int i = 0; i < 100000; ++i)
+            ASSERT_EQ(vec[i], i);
+
+        vec.resize(2);
+
+        ASSERT_EQ(vec.capacity(), 4);
+        ASSERT_EQ(vec[1], 1);
+    }
+
+    {
+        InlineVector<double, 4, HugePageAllocator<double>> vec;
+        vec.resize(1 << 20);
+
+        ASSERT_TRUE(aligned_to(vec.begin(), kHugePageSize));
+        ASSERT_EQ(vec[12345], 0.0);
+    }
+
+    {
+        // Not trivially copyable, grows by copying
+        InlineVector<std::string, 1, HugePageAllocator<std::string, 4096>> vec;
+
+        for (int i = 0; i < 1000; ++i)
+            vec.push_back(std::to_string(i));
+
+        for (int i = 0; i < 1000; ++i)
+            ASSERT_EQ(vec[i], std::to_string(i));
+    }
+}
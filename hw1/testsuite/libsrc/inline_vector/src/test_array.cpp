@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "inline_vector/inline_vector_array.hpp"
+
+#include <numeric>
+#include <vector>
+
+TEST(InlineVectorArrayTest, FromVectors) {
+    std::vector<InlineVector<int, 2>> source(4);
+    source[0] = {1, 2};
+    source[2] = {3, 4, 5, 6};
+    source[3] = {7};
+
+    InlineVectorArray<int> array(source.begin(), source.end());
+
+    ASSERT_EQ(array.size(), 4);
+    ASSERT_EQ(array.total_size(), 7);
+    for (std::size_t row = 0; row < source.size(); ++row) {
+        ASSERT_EQ(array[row].size(), source[row].size());
+        ASSERT_TRUE(std::equal(array[row].begin(), array[row].end(), source[row].begin()));
+    }
+    ASSERT_TRUE(array[1].empty());
+    ASSERT_EQ(array[2].front(), 3);
+    ASSERT_EQ(array[2].back(), 6);
+    ASSERT_EQ(array[2][1], 4);
+    ASSERT_THROW(array[1].front(), std::out_of_range);
+    ASSERT_THROW(array[2][4], std::out_of_range);
+    ASSERT_THROW(array[4], std::out_of_range);
+}
+
+TEST(InlineVectorArrayTest, Streaming) {
+    InlineVectorArray<int> array;
+
+    ASSERT_TRUE(array.empty());
+    ASSERT_THROW(array.push_back(1), std::out_of_range);
+
+    for (int row = 0; row < 100; ++row) {
+        array.start_row();
+        for (int i = 0; i < row % 7; ++i)
+            array.push_back(row * 10 + i);
+    }
+
+    ASSERT_EQ(array.size(), 100);
+    for (int row = 0; row < 100; ++row) {
+        ASSERT_EQ(array[row].size(), static_cast<std::size_t>(row % 7));
+        for (int i = 0; i < row % 7; ++i)
+            ASSERT_EQ(array[row][i], row * 10 + i);
+    }
+
+    array.push_row({1, 2, 3});
+
+    ASSERT_EQ(array.size(), 101);
+    ASSERT_EQ(array[100].back(), 3);
+
+    array.clear();
+
+    ASSERT_TRUE(array.empty());
+    ASSERT_EQ(array.total_size(), 0);
+}
+
+TEST(InlineVectorArrayTest, Iterators) {
+    InlineVectorArray<int> array = {{1, 2}, {}, {3, 4, 5}};
+    InlineVectorArray<int> same = {{1, 2}, {}, {3, 4, 5}};
+    InlineVectorArray<int> other = {{1, 2, 3}, {4, 5}};
+
+    ASSERT_FALSE(array == other);
+    ASSERT_TRUE(array != other);
+    ASSERT_FALSE(array != same);
+    ASSERT_FALSE(array == other);
+    ASSERT_EQ(array.end() - array.begin(), 3);
+
+    std::vector<int> sums;
+    for (auto row : array)
+        sums.push_back(std::accumulate(row.begin(), row.end(), 0));
+    ASSERT_EQ(sums, (std::vector<int>{3, 0, 12}));
+
+    ASSERT_EQ(array[2], (InlineVectorView<int>(same[2].data(), 3)));
+    ASSERT_NE(array[0], other[0]);
+
+    auto first = array.begin();
+    auto last = array.end();
+    ASSERT_TRUE(first < last && last > first);
+    ASSERT_TRUE(first <= first && first >= first);
+    ASSERT_FALSE(last <= first || first >= last);
+    ASSERT_EQ(2 + first, first + 2);
+    ASSERT_EQ((*(2 + first)).size(), 3);
+}
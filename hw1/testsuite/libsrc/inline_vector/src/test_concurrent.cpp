@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "inline_vector/concurrent_inline_vector.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::atomic<int> segment_allocations{0};
+
+template<class T>
+struct CountingAllocator : std::allocator<T> {
+    template<class U>
+    struct rebind {
+        using other = CountingAllocator<U>;
+    };
+
+    CountingAllocator() = default;
+
+    template<class U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(std::size_t count) {
+        ++segment_allocations;
+        return std::allocator<T>::allocate(count);
+    }
+};
+
+}  // namespace
+
+TEST(ConcurrentInlineVectorTest, SingleThread) {
+    ConcurrentInlineVector<int, 4> vec;
+
+    ASSERT_TRUE(vec.empty());
+    ASSERT_THROW(vec[0], std::out_of_range);
+
+    for (int i = 0; i < 100; ++i)
+        vec.push_back(i);
+
+    ASSERT_EQ(vec.size(), 100);
+    for (int i = 0; i < 100; ++i)
+        ASSERT_EQ(vec[i], i);
+    ASSERT_THROW(vec[100], std::out_of_range);
+}
+
+TEST(ConcurrentInlineVectorTest, StableReferences) {
+    ConcurrentInlineVector<int, 2> vec;
+    std::vector<int*> refs;
+
+    for (int i = 0; i < 1000; ++i)
+        refs.push_back(&vec.push_back(i));
+
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(refs[i], &vec[i]);
+        ASSERT_EQ(*refs[i], i);
+    }
+}
+
+TEST(ConcurrentInlineVectorTest, Freeze) {
+    {
+        ConcurrentInlineVector<int, 4> vec;
+        vec.push_back(1);
+        vec.push_back(2);
+        InlineVector<int, 4> ideal_vec = {1, 2};
+
+        ASSERT_EQ(vec.freeze(), ideal_vec);
+    }
+
+    {
+        ConcurrentInlineVector<int, 4> vec;
+        InlineVector<int, 4> ideal_vec;
+        for (int i = 0; i < 37; ++i) {
+            vec.push_back(i);
+            ideal_vec.push_back(i);
+        }
+
+        ASSERT_EQ(vec.freeze(), ideal_vec);
+
+        vec.clear();
+
+        ASSERT_TRUE(vec.empty());
+        ASSERT_TRUE(vec.freeze().empty());
+    }
+}
+
+TEST(ConcurrentInlineVectorTest, ManyProducers) {
+    constexpr int kThreads = 8;
+    constexpr int kPerThread = 5000;
+    ConcurrentInlineVector<int, 16> vec;
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < kThreads; ++t) {
+        producers.emplace_back([&vec, t] {
+            for (int i = 0; i < kPerThread; ++i)
+                vec.push_back(t * kPerThread + i);
+        });
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    ASSERT_EQ(vec.size(), kThreads * kPerThread);
+    std::vector<int> seen(kThreads * kPerThread, 0);
+    for (std::size_t i = 0; i < vec.size(); ++i)
+        ++seen[vec[i]];
+    for (int count : seen)
+        ASSERT_EQ(count, 1);
+
+    InlineVector<int, 16> frozen = vec.freeze();
+    ASSERT_EQ(frozen.size(), vec.size());
+}
+
+TEST(ConcurrentInlineVectorTest, SegmentAllocatedOnce) {
+    constexpr int kThreads = 8;
+    constexpr int kPerThread = 20000;
+    ConcurrentInlineVector<int, 1, CountingAllocator<int>> vec;
+    segment_allocations = 0;
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < kThreads; ++t) {
+        producers.emplace_back([&vec] {
+            for (int i = 0; i < kPerThread; ++i)
+                vec.push_back(i);
+        });
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    // Every segment in use, plus the one after the last, started by its first producer
+    auto last = inline_vector_detail::segment_position(kThreads * kPerThread - 2, 1);
+    ASSERT_EQ(segment_allocations, static_cast<int>(last.segment + 2));
+}
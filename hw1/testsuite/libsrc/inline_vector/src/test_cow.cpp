@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include "inline_vector/inline_vector.hpp"
+
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using CowVector = InlineVector<int, 4, std::allocator<int>, CopyOnWrite>;
+
+template<class Vector>
+bool shares_storage(const Vector& lhs, const Vector& rhs) {
+    return lhs.begin() == rhs.begin();
+}
+
+TEST(InlinedVectorCowTest, DeepCopyHasNoRefCount) {
+    ASSERT_EQ(sizeof(CowVector), sizeof(InlineVector<int, 4>) + sizeof(void*));
+}
+
+TEST(InlinedVectorCowTest, InlineCopiesAreDeep) {
+    CowVector vec = {1, 2, 3};
+    CowVector vec_copy(vec);
+
+    ASSERT_FALSE(shares_storage(vec, vec_copy));
+
+    vec_copy[0] = 10;
+
+    ASSERT_EQ(vec[0], 1);
+}
+
+TEST(InlinedVectorCowTest, SpilledCopiesShare) {
+    CowVector vec = {1, 2, 3, 4, 5, 6};
+    CowVector vec_copy_1(vec);
+    CowVector vec_copy_2;
+    vec_copy_2 = vec;
+
+    ASSERT_TRUE(shares_storage(vec, vec_copy_1));
+    ASSERT_TRUE(shares_storage(vec, vec_copy_2));
+    ASSERT_EQ(vec, vec_copy_1);
+    ASSERT_EQ(vec, vec_copy_2);
+
+    vec_copy_1[2] = 300;
+
+    ASSERT_FALSE(shares_storage(vec, vec_copy_1));
+    ASSERT_TRUE(shares_storage(vec, vec_copy_2));
+    ASSERT_EQ(vec[2], 3);
+    ASSERT_EQ(vec_copy_1[2], 300);
+
+    vec.push_back(7);
+
+    ASSERT_FALSE(shares_storage(vec, vec_copy_2));
+    ASSERT_EQ(vec.size(), 7);
+    ASSERT_EQ(vec_copy_2, (CowVector{1, 2, 3, 4, 5, 6}));
+}
+
+TEST(InlinedVectorCowTest, ModifiersDetach) {
+    const CowVector source = {1, 2, 3, 4, 5, 6};
+
+    {
+        CowVector vec(source);
+        vec.pop_back();
+        vec.pop_back();
+
+        ASSERT_EQ(vec, (CowVector{1, 2, 3, 4}));
+        ASSERT_EQ(source.size(), 6);
+    }
+
+    {
+        CowVector vec(source);
+        vec.insert(vec.begin() + 1, -1);
+        vec.erase(vec.begin());
+
+        ASSERT_EQ(vec, (CowVector{-1, 2, 3, 4, 5, 6}));
+        ASSERT_EQ(source[0], 1);
+    }
+
+    {
+        CowVector vec(source);
+        CowVector copy(vec);
+        copy.erase(copy.begin());
+
+        ASSERT_EQ(copy, (CowVector{2, 3, 4, 5, 6}));
+        ASSERT_EQ(vec, source);
+    }
+
+    {
+        CowVector vec(source);
+        vec.resize(8);
+        vec.back() = 8;
+
+        ASSERT_EQ(source.size(), 6);
+        ASSERT_EQ(source.back(), 6);
+    }
+
+    {
+        CowVector vec(source);
+        vec.clear();
+        vec = source;
+        vec = CowVector{1};
+
+        ASSERT_EQ(vec.size(), 1);
+        ASSERT_EQ(source.size(), 6);
+    }
+}
+
+TEST(InlinedVectorCowTest, NonTrivialType) {
+    using StringVector = InlineVector<std::string, 1, std::allocator<std::string>, CopyOnWrite>;
+    StringVector vec = {"a", "b", "c"};
+    StringVector vec_copy(vec);
+
+    vec_copy.front() = "z";
+
+    ASSERT_EQ(vec.front(), "a");
+    ASSERT_EQ(vec_copy.front(), "z");
+}
+
+TEST(InlinedVectorCowTest, PopBackToInlineKeepsShared) {
+    using StringVector = InlineVector<std::string, 1, std::allocator<std::string>, CopyOnWrite>;
+    StringVector vec = {"a", "b"};
+    StringVector vec_copy(vec);
+
+    // pop_back does not detach, the survivor must be copied out of the shared block
+    vec_copy.pop_back();
+
+    ASSERT_EQ(vec_copy.size(), 1);
+    ASSERT_EQ(vec_copy.front(), "a");
+    ASSERT_EQ(vec.size(), 2);
+    ASSERT_EQ(vec[0], "a");
+    ASSERT_EQ(vec[1], "b");
+}
+
+TEST(InlinedVectorCowTest, ConcurrentCopies) {
+    CowVector source;
+    for (int i = 0; i < 1000; ++i)
+        source.push_back(i);
+
+    std::vector<std::thread> workers;
+    std::vector<long> sums(8, 0);
+    for (std::size_t t = 0; t < sums.size(); ++t) {
+        workers.emplace_back([&source, &sums, t] {
+            for (int round = 0; round < 200; ++round) {
+                CowVector copy(source);
+                CowVector second = copy;
+                long sum = 0;
+                for (int x : std::as_const(second))
+                    sum += x;
+                if (round % 2 == 0)
+                    copy[0] = -1;
+                sums[t] += sum + copy[0];
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    for (long sum : sums)
+        ASSERT_EQ(sum, 200L * 499500 - 100);
+    ASSERT_EQ(source[0], 0);
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "inline_vector/inline_deque.hpp"
+
+#include <deque>
+#include <random>
+#include <string>
+
+TEST(InlineDequeTest, PushPop) {
+    InlineDeque<int, 3> deque;
+
+    ASSERT_TRUE(deque.empty());
+    ASSERT_EQ(deque.capacity(), 3);
+    ASSERT_THROW(deque.front(), std::out_of_range);
+    ASSERT_THROW(deque.pop_front(), std::out_of_range);
+    ASSERT_THROW(deque.pop_back(), std::out_of_range);
+
+    deque.push_back(1);
+    deque.push_front(0);
+    deque.push_back(2);
+
+    ASSERT_EQ(deque.size(), 3);
+    ASSERT_EQ(deque.capacity(), 3);
+    ASSERT_EQ(deque.front(), 0);
+    ASSERT_EQ(deque.back(), 2);
+
+    deque.push_front(-1);
+
+    ASSERT_EQ(deque.capacity(), 4);
+    ASSERT_EQ(deque, (InlineDeque<int, 3>{-1, 0, 1, 2}));
+
+    deque.push_back(3);
+
+    ASSERT_EQ(deque.capacity(), 8);
+    for (int i = 0; i < 5; ++i)
+        ASSERT_EQ(deque[i], i - 1);
+    ASSERT_THROW(deque[5], std::out_of_range);
+
+    deque.pop_front();
+    deque.pop_back();
+
+    ASSERT_EQ(deque, (InlineDeque<int, 3>{0, 1, 2}));
+    ASSERT_EQ(deque.capacity(), 8);
+
+    deque.shrink_to_fit();
+
+    ASSERT_EQ(deque.capacity(), 3);
+    ASSERT_EQ(deque, (InlineDeque<int, 3>{0, 1, 2}));
+
+    deque.clear();
+
+    ASSERT_TRUE(deque.empty());
+}
+
+TEST(InlineDequeTest, Wraparound) {
+    InlineDeque<int, 4> deque;
+
+    // Head walks around the inline ring many times without spilling
+    for (int i = 0; i < 100; ++i) {
+        deque.push_back(i);
+        deque.push_back(i + 1);
+        ASSERT_EQ(deque.front(), i);
+        deque.pop_front();
+        deque.pop_front();
+    }
+    ASSERT_EQ(deque.capacity(), 4);
+
+    for (int i = 0; i < 3; ++i)
+        deque.push_front(i);
+    deque.push_back(10);
+
+    ASSERT_EQ(deque, (InlineDeque<int, 4>{2, 1, 0, 10}));
+
+    // Spill from a wrapped ring keeps the logical order
+    deque.push_front(3);
+
+    ASSERT_EQ(deque, (InlineDeque<int, 4>{3, 2, 1, 0, 10}));
+}
+
+TEST(InlineDequeTest, MatchesStdDeque) {
+    InlineDeque<std::string, 5> deque;
+    std::deque<std::string> expected;
+    std::mt19937 rng(7);
+
+    for (int step = 0; step < 5000; ++step) {
+        std::string value = std::to_string(step);
+        switch (rng() % 4) {
+            case 0:
+                deque.push_back(value);
+                expected.push_back(value);
+                break;
+            case 1:
+                deque.push_front(value);
+                expected.push_front(value);
+                break;
+            case 2:
+                if (!expected.empty()) {
+                    deque.pop_back();
+                    expected.pop_back();
+                }
+                break;
+            default:
+                if (!expected.empty()) {
+                    deque.pop_front();
+                    expected.pop_front();
+                }
+                break;
+        }
+        ASSERT_EQ(deque.size(), expected.size());
+    }
+    ASSERT_TRUE(std::equal(deque.begin(), deque.end(), expected.begin(), expected.end()));
+
+    InlineDeque<std::string, 5> copy = deque;
+
+    ASSERT_EQ(copy, deque);
+    ASSERT_EQ(copy.end() - copy.begin(), static_cast<std::ptrdiff_t>(expected.size()));
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "inline_vector/io.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+
+namespace {
+
+// Temporary file with the given contents, removed on destruction.
+// Setup failures throw, so gtest reports them instead of confusing read assertions.
+class TempFile {
+public:
+    explicit TempFile(const std::string& contents) {
+        char path[] = "/tmp/inline_vector_io_XXXXXX";
+        fd_ = ::mkstemp(path);
+        if (fd_ < 0) {
+            throw std::system_error(errno, std::generic_category(), "mkstemp");
+        }
+        path_ = path;
+        ssize_t written = ::write(fd_, contents.data(), contents.size());
+        if (written != static_cast<ssize_t>(contents.size())) {
+            int error = written < 0 ? errno : EIO;
+            ::close(fd_);
+            ::unlink(path_.c_str());
+            throw std::system_error(error, std::generic_category(), "write");
+        }
+    }
+
+    ~TempFile() {
+        ::close(fd_);
+        ::unlink(path_.c_str());
+    }
+
+    int fd() const { return fd_; }
+
+private:
+    int fd_;
+    std::string path_;
+};
+
+std::string text(std::size_t size) {
+    std::string result;
+    for (std::size_t i = 0; i < size; ++i)
+        result.push_back(static_cast<char>('a' + i % 26));
+    return result;
+}
+
+}  // namespace
+
+TEST(InlinedVectorIoTest, AppendUninitialized) {
+    {
+        InlineVector<char, 8> vec = {'x'};
+        char* tail = vec.append_uninitialized(3);
+
+        ASSERT_EQ(vec.size(), 4);
+        ASSERT_EQ(vec.capacity(), 8);
+        ASSERT_EQ(tail, vec.begin() + 1);
+
+        std::fill(tail, tail + 3, 'y');
+        tail = vec.append_uninitialized(10);
+
+        ASSERT_EQ(vec.size(), 14);
+        ASSERT_EQ(vec.capacity(), 16);
+        ASSERT_EQ(tail, vec.begin() + 4);
+        ASSERT_EQ(std::string(vec.begin(), vec.begin() + 4), "xyyy");
+    }
+
+    {
+        InlineVector<int, 4> vec = {1, 2, 3, 4, 5, 6};
+
+        vec.resize_for_overwrite(3);
+
+        ASSERT_EQ(vec.size(), 3);
+        ASSERT_EQ(vec.capacity(), 4);
+        ASSERT_EQ(vec[2], 3);
+
+        vec.resize_for_overwrite(5);
+        vec[3] = 7;
+        vec[4] = 8;
+
+        ASSERT_EQ(vec.size(), 5);
+        ASSERT_EQ(vec[0], 1);
+        ASSERT_EQ(vec[4], 8);
+    }
+}
+
+TEST(InlinedVectorIoTest, ReadFd) {
+    std::string contents = text(1000);
+    TempFile file(contents);
+    InlineVector<char, 256> vec;
+
+    ASSERT_EQ(pread_append(file.fd(), vec, 100, 0), 100);
+    ASSERT_EQ(vec.size(), 100);
+    ASSERT_EQ(vec.capacity(), 256);
+
+    // Short read at the end of file trims the tail
+    ASSERT_EQ(pread_append(file.fd(), vec, 4096, 100), 900);
+    ASSERT_EQ(vec.size(), 1000);
+    ASSERT_EQ(std::string(vec.begin(), vec.end()), contents);
+
+    ASSERT_EQ(pread_append(file.fd(), vec, 10, 1000), 0);
+    ASSERT_EQ(vec.size(), 1000);
+
+    ASSERT_EQ(pread_append(-1, vec, 10, 0), -1);
+    ASSERT_EQ(vec.size(), 1000);
+
+    vec.clear();
+    ::lseek(file.fd(), 0, SEEK_SET);
+    while (read_append(file.fd(), vec, 64) > 0) {
+    }
+
+    ASSERT_EQ(std::string(vec.begin(), vec.end()), contents);
+}
+
+TEST(InlinedVectorIoTest, ReadStream) {
+    std::string contents = text(300);
+    std::istringstream in(contents);
+    InlineVector<char, 16> vec;
+
+    ASSERT_EQ(read_append(in, vec, 10), 10);
+    ASSERT_EQ(vec.size(), 10);
+    ASSERT_EQ(read_append(in, vec, 1000), 290);
+    ASSERT_EQ(vec.size(), 300);
+    ASSERT_EQ(std::string(vec.begin(), vec.end()), contents);
+    ASSERT_EQ(read_append(in, vec, 10), 0);
+    ASSERT_EQ(vec.size(), 300);
+}
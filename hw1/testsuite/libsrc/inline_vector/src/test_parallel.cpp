@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "inline_vector/parallel.hpp"
+
+#include <random>
+#include <string>
+
+TEST(InlinedVectorParallelTest, Fill) {
+    {
+        InlineVector<int, 4> vec = {1, 2, 3};
+
+        parallel_fill(vec, 7, 0, 4);
+
+        ASSERT_EQ(vec, (InlineVector<int, 4>{7, 7, 7}));
+    }
+
+    {
+        InlineVector<int, 4> vec;
+        for (int i = 0; i < 1000; ++i)
+            vec.push_back(i);
+
+        parallel_fill(vec, -1, 0, 4);
+
+        ASSERT_EQ(vec.size(), 1000);
+        for (int x : vec)
+            ASSERT_EQ(x, -1);
+    }
+}
+
+TEST(InlinedVectorParallelTest, Transform) {
+    InlineVector<int, 4> vec;
+    for (int i = 0; i < 1001; ++i)
+        vec.push_back(i);
+
+    parallel_transform(vec, [](int x) { return x * 2; }, 0, 3);
+
+    for (int i = 0; i < 1001; ++i)
+        ASSERT_EQ(vec[i], i * 2);
+}
+
+TEST(InlinedVectorParallelTest, Sort) {
+    for (std::size_t threads : {1, 2, 3, 5, 8}) {
+        InlineVector<int, 8> vec;
+        std::mt19937 rng(threads);
+        for (int i = 0; i < 997; ++i)
+            vec.push_back(static_cast<int>(rng() % 100));
+        std::vector<int> expected(vec.begin(), vec.end());
+        std::sort(expected.begin(), expected.end());
+
+        parallel_sort(vec, std::less<int>(), 0, threads);
+
+        ASSERT_TRUE(std::equal(vec.begin(), vec.end(), expected.begin(), expected.end()));
+    }
+
+    // Merge slices cut through runs of equal keys and through run boundaries
+    for (std::size_t threads : {4, 7}) {
+        InlineVector<std::string, 8> vec;
+        std::mt19937 rng(threads);
+        for (int i = 0; i < 20011; ++i)
+            vec.push_back(std::to_string(rng() % 50));
+        std::vector<std::string> expected(vec.begin(), vec.end());
+        std::sort(expected.begin(), expected.end());
+
+        parallel_sort(vec, std::less<std::string>(), 0, threads);
+
+        ASSERT_TRUE(std::equal(vec.begin(), vec.end(), expected.begin(), expected.end()));
+    }
+
+    {
+        InlineVector<int, 8> vec = {5, 1, 4, 2, 3};
+
+        parallel_sort(vec, std::greater<int>());
+
+        ASSERT_EQ(vec, (InlineVector<int, 8>{5, 4, 3, 2, 1}));
+    }
+}
+
+TEST(InlinedVectorParallelTest, Reduce) {
+    {
+        InlineVector<int, 4> vec = {};
+
+        ASSERT_EQ(parallel_reduce(vec, 10), 10);
+    }
+
+    {
+        InlineVector<int, 4> vec;
+        for (int i = 1; i <= 1000; ++i)
+            vec.push_back(i);
+
+        for (std::size_t threads : {1, 2, 7, 16})
+            ASSERT_EQ(parallel_reduce(vec, 0L, std::plus<>(), 0, threads), 500500L);
+        ASSERT_EQ(parallel_reduce(vec, 0, [](int a, int b) { return std::max(a, b); }, 0, 4), 1000);
+    }
+}
+
+TEST(InlinedVectorParallelTest, Exceptions) {
+    InlineVector<int, 4> vec;
+    for (int i = 0; i < 100; ++i)
+        vec.push_back(i);
+
+    ASSERT_THROW(parallel_transform(vec, [](int x) {
+        if (x == 80)
+            throw std::runtime_error("bad element");
+        return x;
+    }, 0, 4), std::runtime_error);
+}
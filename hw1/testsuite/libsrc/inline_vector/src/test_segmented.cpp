@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include "inline_vector/segmented_inline_vector.hpp"
+
+#include <numeric>
+#include <vector>
+
+TEST(SegmentedInlineVectorTest, PushPop) {
+    SegmentedInlineVector<int, 4> vec;
+
+    ASSERT_EQ(vec.capacity(), 4);
+    ASSERT_THROW(vec.back(), std::out_of_range);
+
+    for (int i = 0; i < 4; ++i)
+        vec.push_back(i);
+
+    ASSERT_EQ(vec.size(), 4);
+    ASSERT_EQ(vec.capacity(), 4);
+
+    vec.push_back(4);
+
+    ASSERT_EQ(vec.capacity(), 8);
+
+    for (int i = 5; i < 13; ++i)
+        vec.push_back(i);
+
+    ASSERT_EQ(vec.size(), 13);
+    ASSERT_EQ(vec.capacity(), 16);
+    for (int i = 0; i < 13; ++i)
+        ASSERT_EQ(vec[i], i);
+    ASSERT_EQ(vec.front(), 0);
+    ASSERT_EQ(vec.back(), 12);
+    ASSERT_THROW(vec[13], std::out_of_range);
+
+    vec.pop_back();
+
+    ASSERT_EQ(vec.back(), 11);
+    ASSERT_EQ(vec.capacity(), 16);
+
+    vec.clear();
+
+    ASSERT_TRUE(vec.empty());
+    ASSERT_EQ(vec.capacity(), 4);
+    ASSERT_THROW(vec.pop_back(), std::out_of_range);
+}
+
+TEST(SegmentedInlineVectorTest, StableReferences) {
+    SegmentedInlineVector<int, 2> vec;
+    std::vector<int*> refs;
+
+    for (int i = 0; i < 1000; ++i) {
+        vec.push_back(i);
+        refs.push_back(&vec.back());
+    }
+
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(refs[i], &vec[i]);
+}
+
+TEST(SegmentedInlineVectorTest, Iterators) {
+    SegmentedInlineVector<int, 3> vec;
+    for (int i = 0; i < 50; ++i)
+        vec.push_back(i);
+
+    ASSERT_EQ(vec.end() - vec.begin(), 50);
+    ASSERT_EQ(std::accumulate(vec.begin(), vec.end(), 0), 1225);
+    ASSERT_EQ(*(vec.begin() + 20), 20);
+    ASSERT_EQ(vec.begin()[33], 33);
+    ASSERT_EQ(*(vec.end() - 1), 49);
+
+    auto it = vec.end();
+    for (int i = 49; i >= 0; --i)
+        ASSERT_EQ(*--it, i);
+    ASSERT_TRUE(it == vec.begin());
+
+    SegmentedInlineVector<int, 3>::const_iterator cit = vec.begin();
+    ASSERT_EQ(*(cit + 4), 4);
+
+    std::reverse(vec.begin(), vec.end());
+    ASSERT_EQ(vec.front(), 49);
+    ASSERT_EQ(vec.back(), 0);
+    std::sort(vec.begin(), vec.end());
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+}
+
+TEST(SegmentedInlineVectorTest, InsertErase) {
+    SegmentedInlineVector<int, 2> vec = {1, 2, 3};
+    SegmentedInlineVector<int, 2> ideal_vec_1 = {0, 1, 2, 5, 3};
+    SegmentedInlineVector<int, 2> ideal_vec_2 = {1, 2, 5};
+
+    vec.insert(vec.begin(), 0);
+    vec.insert(vec.begin() + 3, 5);
+
+    ASSERT_EQ(vec, ideal_vec_1);
+
+    vec.erase(vec.begin());
+    vec.erase(vec.end() - 1);
+
+    ASSERT_EQ(vec, ideal_vec_2);
+    ASSERT_THROW(vec.erase(vec.end()), std::out_of_range);
+}
+
+TEST(SegmentedInlineVectorTest, CopyFlatten) {
+    SegmentedInlineVector<int, 4> vec;
+    InlineVector<int, 4> ideal_vec;
+    for (int i = 0; i < 30; ++i) {
+        vec.push_back(i);
+        ideal_vec.push_back(i);
+    }
+
+    SegmentedInlineVector<int, 4> vec_copy_1(vec);
+    SegmentedInlineVector<int, 4> vec_copy_2;
+    vec_copy_2 = vec;
+
+    ASSERT_EQ(vec, vec_copy_1);
+    ASSERT_EQ(vec, vec_copy_2);
+    ASSERT_NE(&vec[20], &vec_copy_1[20]);
+    ASSERT_EQ(vec.flatten(), ideal_vec);
+}